@@ -0,0 +1,138 @@
+#ifndef __CHECKERS_ENGINE_HPP__
+#define __CHECKERS_ENGINE_HPP__
+
+#include "../resources/headers/StaticBoard.hpp"
+#include "../resources/headers/Piece.hpp"
+#include "../resources/headers/Snapshot.hpp"
+
+#include <cassert>
+#include <cstdint>
+#include <string>
+
+namespace SamHovhannisyan::CheckersGame
+{
+    /// @brief Headless checkers rules
+    /// @details Owns the position, the side to move and the end-of-game bookkeeping and knows
+    ///          nothing about the terminal. Black moves first and up the board. Men move and
+    ///          capture one square diagonally forward; kings slide any distance and capture a
+    ///          piece at any distance on an open diagonal, landing on any empty square beyond
+    ///          it. Capturing is compulsory, a piece that captured goes on capturing while it
+    ///          can, and reaching the far row ends the move.
+    ///          The position is three masks over the 32 dark squares, numbered row by row
+    ///          (square = 4 * y + x / 2): black pieces, white pieces and kings. Moves of every
+    ///          piece at once are found with shifts and masks instead of scanning the board.
+    class Engine
+    {
+    public:
+        enum BoardElements : int
+        {
+            EMPTY,
+            WHITE,
+            BLACK,
+            WHITE_KING,
+            BLACK_KING
+        };
+
+        typedef Piece::Piece<BoardElements> Piece;
+        typedef Coordinate::Coordinate Coordinate;
+        typedef Board::StaticBoard<Piece, 8, 8> board_type;
+        /// @brief One bit per dark square
+        typedef uint32_t mask_type;
+
+        static const uint32_t SNAPSHOT_KIND;
+        static const uint8_t SQUARES = 32;
+        static const uint8_t NO_SQUARE = SQUARES;
+        /// @brief A side never has more than 12 pieces and a piece never reaches more than 13 squares
+        static const size_t MAX_MOVES = 12 * 13;
+
+        /// @brief A move between dark squares and the square of the piece it captures, if any
+        struct Move
+        {
+            uint8_t from;
+            uint8_t to;
+            uint8_t captured;
+        };
+
+        /// @brief The legal moves of a position, kept in place without touching the heap
+        class MoveList
+        {
+        public:
+            MoveList() : size_(0) {}
+
+            void clear() { size_ = 0; }
+            void push(const Move& move) { assert(size_ < MAX_MOVES); moves_[size_++] = move; }
+            size_t size() const { return size_; }
+            bool empty() const { return size_ == 0; }
+            const Move& operator[](const size_t index) const { assert(index < size_); return moves_[index]; }
+            const Move* begin() const { return moves_; }
+            const Move* end() const { return moves_ + size_; }
+
+        private:
+            Move moves_[MAX_MOVES];
+            size_t size_;
+        };
+
+    public:
+        Engine();
+
+        /// @brief Set up the starting position with black to move
+        void reset();
+        bool isLegalMove(const Coordinate& from, const Coordinate& to) const;
+        /// @brief Play a legal move for the side to move
+        /// @return true when the turn passed to the other side, false when the same side
+        ///         has to move again to continue a capture
+        bool move(const Coordinate& from, const Coordinate& to);
+        bool move(const Move& move);
+        /// @brief Replace the contents of moves with every legal move of the side to move
+        void legalMoves(MoveList& moves) const;
+
+        bool isGameOver() const { return game_over_; }
+        /// @brief true when the side to move lost, having no piece or no legal move left
+        bool isWin() const { return win_; }
+        bool isDraw() const { return draw_; }
+        /// @brief true when black is to move
+        bool getPlayerTurn() const { return player_turn_; }
+        /// @brief Pieces left as {black, white}
+        const std::pair<int, int>& getPiecesCount() const { return players_pieces_; }
+        /// @brief The position as a board of pieces, for drawing and snapshots
+        board_type getBoard() const;
+        Piece getPiece(const Coordinate& coord) const;
+
+        /// @brief The dark square of a coordinate, NO_SQUARE for light squares and outside the board
+        static uint8_t squareOf(const Coordinate& coord);
+        static Coordinate coordinateOf(const uint8_t square);
+
+        void save(const std::string& path) const;
+        void load(const std::string& path);
+        Snapshot::StateWriter saveState() const;
+
+    private:
+        mask_type own() const { return player_turn_ ? black_ : white_; }
+        mask_type opponent() const { return player_turn_ ? white_ : black_; }
+        mask_type empty() const { return ~(black_ | white_); }
+        /// @brief Append the captures, or the quiet moves, of the pieces in movers
+        void captures(const mask_type movers, MoveList& moves) const;
+        void quietMoves(const mask_type movers, MoveList& moves) const;
+        /// @brief Whether any of the pieces in movers can capture
+        bool canCapture(const mask_type movers) const;
+        bool canMove() const;
+        void changePlayer();
+        bool checkDraw();
+
+    private:
+        bool game_over_;
+        bool player_turn_;
+        mask_type black_;
+        mask_type white_;
+        mask_type kings_;
+        /// @brief The piece that has to go on capturing, NO_SQUARE between turns
+        uint8_t continuing_;
+        std::pair<int, int> players_pieces_;
+        std::pair<int, int> last_pieces_;
+        int moves_without_progress_;
+        bool win_;
+        bool draw_;
+    };
+}
+
+#endif // __CHECKERS_ENGINE_HPP__
@@ -1,62 +1,44 @@
 #ifndef __CHECKERS_HPP__
 #define __CHECKERS_HPP__
 
-#include "../resources/headers/Board.hpp"
-#include "../resources/headers/Piece.hpp"
+#include "../headers/Engine.hpp"
+#include "../resources/headers/Viewport.hpp"
 
 #include <iostream>
+#include <string>
 
 namespace SamHovhannisyan::CheckersGame
 {
     class Checkers
     {
-    private:
-        enum BoardElements : int
-        {
-            EMPTY,
-            WHITE,
-            BLACK,
-            WHITE_KING,
-            BLACK_KING
-        };
-    
     public:
-        typedef Piece::Piece<BoardElements> Piece;
-        typedef Coordinate::Coordinate Coordinate;
+        typedef Engine::Coordinate Coordinate;
+        typedef Engine::board_type board_type;
 
     public:
         Checkers();
         void start();
+        void save(const std::string& path) const;
+        void load(const std::string& path);
+        void setCheckpoint(const std::string& path);
     
     private:
-        void generateDefaultBoard();
-        void drawBoard() const;
+        void drawBoard();
+        /// @brief Fit the viewport to the terminal, forcing a full redraw when its size changed
+        void layout();
+        void drawCell(const Coordinate& coord) const;
         bool handleInput();
-        bool movePiece(const Coordinate& from, const Coordinate& to);
-        bool movePieceMan(const Coordinate& from, const Coordinate& to);
-        bool movePieceKing(const Coordinate& from, const Coordinate& to);
-        void takePiece(const Coordinate& coord);
-        void changePlayer();
-        void promote(const Coordinate& coord);
-        Piece& getPiece(const Coordinate& coord);
-        const Piece& getPiece(const Coordinate& coord) const;
-        std::vector<Coordinate> getPieceCoordinates() const;
-        bool isOpponentsPiece(const Piece& piece) const;
-        bool isFreePieceAvailable(Coordinate& coord) const;
-        bool isFreePieceAround(const Coordinate& coord) const;
-        bool isFreePieceAroundMan(const Coordinate& coord) const;
-        bool isFreePieceAroundKing(const Coordinate& coord) const;
-        bool isLegalMove(const Coordinate& from, const Coordinate& to) const;
-        bool hasAvailableMove(const Coordinate& coord) const;
-        bool isWin() const;
-        bool isDraw() const;
 
     private:
-        bool game_over_;
-        bool player_turn_;
-        // bool is_capture_available_;
-        Board::Board<Piece> board_;
-        std::pair<int, int> players_pieces_;
+        Engine engine_;
+        std::string checkpoint_;
+        Snapshot::Writer writer_;
+        board_type drawnBoard_;
+        bool drawn_;
+        Viewport::Viewport viewport_;
+        /// @brief The terminal size the viewport was last fitted to
+        int lines_;
+        int cols_;
     };
 }
 
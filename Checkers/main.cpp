@@ -1,9 +1,24 @@
 #include "headers/Game.hpp"
 
+#include <cstring>
+#include <iostream>
+#include <unistd.h>
+
 int
-main()
+main(int argc, char** argv)
 {
     SamHovhannisyan::CheckersGame::Checkers game;
+
+    // --checkpoint <file>: resume from the file if it exists and keep saving to it
+    for (int i = 1; i + 1 < argc; ++i) {
+        if (std::strcmp(argv[i], "--checkpoint") != 0) { continue; }
+        if (access(argv[i + 1], F_OK) == 0) {
+            try { game.load(argv[i + 1]); }
+            catch (const std::exception& e) { std::cerr << e.what() << std::endl; return 1; }
+        }
+        game.setCheckpoint(argv[i + 1]);
+    }
+
     game.start();
 
     return 0;
@@ -0,0 +1,48 @@
+#include "headers/Engine.hpp"
+
+#include <chrono>
+#include <cstdio>
+#include <random>
+
+namespace
+{
+    typedef std::chrono::steady_clock clock_type;
+    typedef SamHovhannisyan::CheckersGame::Engine Engine;
+}
+
+/// Headless throughput of the checkers rules: random legal moves until the game ends
+int
+main()
+{
+    const size_t GAMES = 20000;
+
+    std::mt19937 random(1);
+    Engine::MoveList moves;
+    Engine engine;
+    size_t plies = 0;
+    size_t blackWins = 0;
+    size_t whiteWins = 0;
+    size_t draws = 0;
+
+    const clock_type::time_point start = clock_type::now();
+    for (size_t game = 0; game < GAMES; ++game) {
+        engine.reset();
+        // A side without moves has lost, so every game ends in a win or the draw rule
+        while (!engine.isGameOver()) {
+            engine.legalMoves(moves);
+            engine.move(moves[random() % moves.size()]);
+            ++plies;
+        }
+        if (engine.isDraw()) { ++draws; }
+        else if (engine.getPlayerTurn()) { ++whiteWins; }
+        else { ++blackWins; }
+    }
+    const std::chrono::duration<double> elapsed = clock_type::now() - start;
+
+    std::printf("%8s %10s %8s %8s %8s %12s %12s\n", 
+                "games", "plies", "black", "white", "draws", "games/s", "plies/s");
+    std::printf("%8zu %10zu %8zu %8zu %8zu %12.0f %12.0f\n", GAMES, plies, blackWins, whiteWins, draws,
+                GAMES / elapsed.count(), plies / elapsed.count());
+
+    return 0;
+}
@@ -0,0 +1,235 @@
+#include "headers/Engine.hpp"
+#include <gtest/gtest.h>
+#include <random>
+#include <set>
+#include <string>
+#include <tuple>
+#include <utility>
+#include <vector>
+
+namespace
+{
+    typedef SamHovhannisyan::CheckersGame::Engine Engine;
+    typedef Engine::Coordinate Coordinate;
+    typedef std::vector<std::pair<Coordinate, Engine::BoardElements>> pieces_type;
+    /// A move as from, to and captured coordinates, (-1, -1) when nothing is captured
+    typedef std::tuple<int, int, int, int, int, int> move_type;
+
+    int
+    sideOf(const Engine::BoardElements value)
+    {
+        if (value == Engine::BLACK || value == Engine::BLACK_KING) { return 1; }
+        if (value == Engine::WHITE || value == Engine::WHITE_KING) { return 2; }
+        return 0;
+    }
+
+    bool
+    isKing(const Engine::BoardElements value)
+    {
+        return value == Engine::BLACK_KING || value == Engine::WHITE_KING;
+    }
+
+    /// Start engine from the given pieces, everything else empty, through a snapshot
+    void
+    setUp(Engine& engine, const pieces_type& pieces, const bool blackToMove)
+    {
+        Engine::board_type board;
+        int32_t black = 0;
+        int32_t white = 0;
+        for (const auto& piece : pieces) {
+            board(piece.first) = Engine::Piece(piece.second);
+            black += sideOf(piece.second) == 1;
+            white += sideOf(piece.second) == 2;
+        }
+
+        SamHovhannisyan::Snapshot::StateWriter state;
+        state.put(blackToMove);
+        state.put<int32_t>(black);
+        state.put<int32_t>(white);
+        state.put(false);
+        state.put(false);
+        state.put(false);
+        state.put<int32_t>(0);
+        const std::string path = "builds/checkers_test.bin";
+        SamHovhannisyan::Snapshot::save(path, Engine::SNAPSHOT_KIND, board, state);
+        engine.load(path);
+    }
+
+    std::set<move_type>
+    movesOf(const Engine& engine)
+    {
+        Engine::MoveList moves;
+        engine.legalMoves(moves);
+        std::set<move_type> result;
+        for (const Engine::Move& move : moves) {
+            const Coordinate from = Engine::coordinateOf(move.from);
+            const Coordinate to = Engine::coordinateOf(move.to);
+            const Coordinate captured = move.captured == Engine::NO_SQUARE ? Coordinate(-1, -1) : Engine::coordinateOf(move.captured);
+            result.insert({ int(from.x), int(from.y), int(to.x), int(to.y), int(captured.x), int(captured.y) });
+        }
+        EXPECT_EQ(result.size(), moves.size());
+        return result;
+    }
+
+    /// The legal moves worked out square by square, to check the mask generator against
+    std::set<move_type>
+    referenceMoves(const Engine::board_type& board, const bool black, const int onlyX, const int onlyY)
+    {
+        const int own = black ? 1 : 2;
+        const int opponent = black ? 2 : 1;
+        const auto inside = [](const int x, const int y) { return x >= 0 && y >= 0 && x < 8 && y < 8; };
+        const auto at = [&board](const int x, const int y) { return board(Coordinate(x, y)).value; };
+        const int directions[4][2] = { { -1, -1 }, { 1, -1 }, { -1, 1 }, { 1, 1 } };
+
+        std::set<move_type> captures;
+        std::set<move_type> quiet;
+        for (int y = 0; y < 8; ++y) {
+            for (int x = 0; x < 8; ++x) {
+                if (sideOf(at(x, y)) != own || (onlyX >= 0 && (x != onlyX || y != onlyY))) { continue; }
+                for (const auto& direction : directions) {
+                    const int dx = direction[0];
+                    const int dy = direction[1];
+                    int nx = x + dx;
+                    int ny = y + dy;
+                    if (!isKing(at(x, y))) {
+                        // Black men move up the board, white men down
+                        if (dy != (black ? -1 : 1) || !inside(nx, ny)) { continue; }
+                        if (sideOf(at(nx, ny)) == 0) { quiet.insert({ x, y, nx, ny, -1, -1 }); }
+                        else if (sideOf(at(nx, ny)) == opponent && inside(nx + dx, ny + dy) && sideOf(at(nx + dx, ny + dy)) == 0) {
+                            captures.insert({ x, y, nx + dx, ny + dy, nx, ny });
+                        }
+                        continue;
+                    }
+                    for (; inside(nx, ny) && sideOf(at(nx, ny)) == 0; nx += dx, ny += dy) { quiet.insert({ x, y, nx, ny, -1, -1 }); }
+                    if (!inside(nx, ny) || sideOf(at(nx, ny)) != opponent) { continue; }
+                    for (int lx = nx + dx, ly = ny + dy; inside(lx, ly) && sideOf(at(lx, ly)) == 0; lx += dx, ly += dy) {
+                        captures.insert({ x, y, lx, ly, nx, ny });
+                    }
+                }
+            }
+        }
+        return !captures.empty() || onlyX >= 0 ? captures : quiet;
+    }
+}
+
+TEST(CheckersTest, StartingPosition)
+{
+    Engine engine;
+    EXPECT_TRUE(engine.getPlayerTurn());
+    EXPECT_EQ(engine.getPiecesCount(), std::make_pair(12, 12));
+    EXPECT_EQ(movesOf(engine).size(), 7);
+    EXPECT_EQ(Engine::squareOf(Coordinate(1, 0)), 0);
+    EXPECT_EQ(Engine::squareOf(Coordinate(0, 0)), uint8_t(Engine::NO_SQUARE));
+    for (uint8_t square = 0; square < Engine::SQUARES; ++square) {
+        EXPECT_EQ(Engine::squareOf(Engine::coordinateOf(square)), square);
+    }
+}
+
+TEST(CheckersTest, ManCaptureIsCompulsory)
+{
+    Engine engine;
+    setUp(engine, { { Coordinate(2, 5), Engine::BLACK }, { Coordinate(6, 5), Engine::BLACK },
+                    { Coordinate(3, 4), Engine::WHITE }, { Coordinate(1, 0), Engine::WHITE } }, true);
+    const std::set<move_type> expected = { { 2, 5, 4, 3, 3, 4 } };
+    EXPECT_EQ(movesOf(engine), expected);
+    EXPECT_FALSE(engine.isLegalMove(Coordinate(6, 5), Coordinate(5, 4)));
+
+    // A man never captures backwards
+    setUp(engine, { { Coordinate(3, 4), Engine::BLACK }, { Coordinate(4, 5), Engine::WHITE } }, true);
+    const std::set<move_type> forward = { { 3, 4, 2, 3, -1, -1 }, { 3, 4, 4, 3, -1, -1 } };
+    EXPECT_EQ(movesOf(engine), forward);
+}
+
+TEST(CheckersTest, CaptureContinues)
+{
+    Engine engine;
+    setUp(engine, { { Coordinate(2, 5), Engine::BLACK }, { Coordinate(3, 4), Engine::WHITE },
+                    { Coordinate(5, 2), Engine::WHITE }, { Coordinate(1, 0), Engine::WHITE } }, true);
+
+    EXPECT_FALSE(engine.move(Coordinate(2, 5), Coordinate(4, 3)));
+    EXPECT_TRUE(engine.getPlayerTurn());
+    // Only the piece that captured may move, and only to capture again
+    const std::set<move_type> expected = { { 4, 3, 6, 1, 5, 2 } };
+    EXPECT_EQ(movesOf(engine), expected);
+
+    EXPECT_TRUE(engine.move(Coordinate(4, 3), Coordinate(6, 1)));
+    EXPECT_FALSE(engine.getPlayerTurn());
+    EXPECT_EQ(engine.getPiecesCount(), std::make_pair(1, 1));
+    EXPECT_EQ(engine.getPiece(Coordinate(3, 4)).value, Engine::EMPTY);
+    EXPECT_EQ(engine.getPiece(Coordinate(5, 2)).value, Engine::EMPTY);
+    EXPECT_FALSE(engine.isGameOver());
+}
+
+TEST(CheckersTest, CrowningEndsTheMove)
+{
+    Engine engine;
+    // After crowning on (5, 0) the new king could capture (6, 1), but the turn is over
+    setUp(engine, { { Coordinate(3, 2), Engine::BLACK }, { Coordinate(4, 1), Engine::WHITE },
+                    { Coordinate(6, 1), Engine::WHITE } }, true);
+    EXPECT_TRUE(engine.move(Coordinate(3, 2), Coordinate(5, 0)));
+    EXPECT_EQ(engine.getPiece(Coordinate(5, 0)).value, Engine::BLACK_KING);
+    EXPECT_EQ(engine.getPiece(Coordinate(6, 1)).value, Engine::WHITE);
+    EXPECT_FALSE(engine.getPlayerTurn());
+
+    // A white man is crowned on the bottom row by a quiet move too
+    setUp(engine, { { Coordinate(1, 6), Engine::WHITE }, { Coordinate(7, 0), Engine::BLACK } }, false);
+    EXPECT_TRUE(engine.move(Coordinate(1, 6), Coordinate(2, 7)));
+    EXPECT_EQ(engine.getPiece(Coordinate(2, 7)).value, Engine::WHITE_KING);
+}
+
+TEST(CheckersTest, KingMovesAndCapturesAtDistance)
+{
+    Engine engine;
+    setUp(engine, { { Coordinate(3, 4), Engine::BLACK_KING }, { Coordinate(7, 6), Engine::WHITE } }, true);
+    EXPECT_EQ(movesOf(engine).size(), 13);
+
+    // A piece far down an open diagonal is captured, landing anywhere beyond it
+    setUp(engine, { { Coordinate(0, 7), Engine::BLACK_KING }, { Coordinate(3, 4), Engine::WHITE } }, true);
+    const std::set<move_type> expected = { { 0, 7, 4, 3, 3, 4 }, { 0, 7, 5, 2, 3, 4 },
+                                           { 0, 7, 6, 1, 3, 4 }, { 0, 7, 7, 0, 3, 4 } };
+    EXPECT_EQ(movesOf(engine), expected);
+
+    // Two pieces in a row cannot be jumped
+    setUp(engine, { { Coordinate(0, 7), Engine::BLACK_KING }, { Coordinate(2, 5), Engine::WHITE },
+                    { Coordinate(3, 4), Engine::WHITE } }, true);
+    const std::set<move_type> blocked = { { 0, 7, 1, 6, -1, -1 } };
+    EXPECT_EQ(movesOf(engine), blocked);
+
+    // Taking the last piece wins: the side left to move has lost
+    setUp(engine, { { Coordinate(0, 7), Engine::BLACK_KING }, { Coordinate(3, 4), Engine::WHITE } }, true);
+    EXPECT_TRUE(engine.move(Coordinate(0, 7), Coordinate(6, 1)));
+    EXPECT_TRUE(engine.isGameOver());
+    EXPECT_TRUE(engine.isWin());
+    EXPECT_FALSE(engine.getPlayerTurn());
+}
+
+TEST(CheckersTest, MatchesReferenceInRandomGames)
+{
+    std::mt19937 random(7);
+    Engine engine;
+    Engine::MoveList moves;
+    for (size_t game = 0; game < 300; ++game) {
+        engine.reset();
+        int onlyX = -1;
+        int onlyY = -1;
+        while (!engine.isGameOver()) {
+            ASSERT_EQ(movesOf(engine), referenceMoves(engine.getBoard(), engine.getPlayerTurn(), onlyX, onlyY));
+            engine.legalMoves(moves);
+            ASSERT_FALSE(moves.empty());
+
+            const Engine::Move move = moves[random() % moves.size()];
+            const Coordinate to = Engine::coordinateOf(move.to);
+            const bool passed = engine.move(Engine::coordinateOf(move.from), to);
+            onlyX = passed ? -1 : int(to.x);
+            onlyY = passed ? -1 : int(to.y);
+        }
+        if (engine.isWin()) { EXPECT_TRUE(referenceMoves(engine.getBoard(), engine.getPlayerTurn(), -1, -1).empty()); }
+    }
+}
+
+int
+main(int argc, char **argv)
+{
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
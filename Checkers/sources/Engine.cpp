@@ -0,0 +1,381 @@
+#include "../headers/Engine.hpp"
+
+#include <cassert>
+
+namespace SamHovhannisyan::CheckersGame
+{
+    const uint32_t Engine::SNAPSHOT_KIND = Snapshot::kindOf("CHKR");
+
+    namespace
+    {
+        typedef Engine::mask_type mask_type;
+
+        enum Direction
+        {
+            UP_LEFT,
+            UP_RIGHT,
+            DOWN_LEFT,
+            DOWN_RIGHT
+        };
+
+        /// Dark squares sit at odd x on even rows and at even x on odd rows, four to a row
+        const mask_type EVEN_ROWS = 0x0F0F0F0F;
+        const mask_type ODD_ROWS  = 0xF0F0F0F0;
+        /// Squares with nothing to their left (x = 0) or right (x = 7)
+        const mask_type LEFT_EDGE  = 0x10101010;
+        const mask_type RIGHT_EDGE = 0x08080808;
+        /// The rows black and white promote on
+        const mask_type TOP_ROW    = 0x0000000F;
+        const mask_type BOTTOM_ROW = 0xF0000000;
+        const mask_type START_WHITE = 0x00000FFF;
+        const mask_type START_BLACK = 0xFFF00000;
+        const Direction BLACK_FORWARD[] = { UP_LEFT, UP_RIGHT };
+        const Direction WHITE_FORWARD[] = { DOWN_LEFT, DOWN_RIGHT };
+        const Direction ALL_DIRECTIONS[] = { UP_LEFT, UP_RIGHT, DOWN_LEFT, DOWN_RIGHT };
+        const size_t BOARD_SIZE = 8;
+        const size_t SQUARES_PER_ROW = 4;
+        const int MOVES_FOR_DRAW = 20;
+
+        mask_type
+        bit(const uint8_t square)
+        {
+            return mask_type(1) << square;
+        }
+
+        /// Every square moved one step in direction; squares that would leave the board drop out
+        mask_type
+        step(const mask_type squares, const Direction direction)
+        {
+            switch (direction)
+            {
+            case UP_LEFT:    return ((squares & EVEN_ROWS) >> 4) | ((squares & ODD_ROWS & ~LEFT_EDGE) >> 5);
+            case UP_RIGHT:   return ((squares & EVEN_ROWS & ~RIGHT_EDGE) >> 3) | ((squares & ODD_ROWS) >> 4);
+            case DOWN_LEFT:  return ((squares & EVEN_ROWS) << 4) | ((squares & ODD_ROWS & ~LEFT_EDGE) << 3);
+            case DOWN_RIGHT: return ((squares & EVEN_ROWS & ~RIGHT_EDGE) << 5) | ((squares & ODD_ROWS) << 4);
+            }
+            return 0;
+        }
+
+        Direction
+        opposite(const Direction direction)
+        {
+            return Direction(DOWN_RIGHT - direction);
+        }
+
+        /// Remove and return the lowest square of squares
+        uint8_t
+        pop(mask_type& squares)
+        {
+            const uint8_t square = uint8_t(__builtin_ctz(squares));
+            squares &= squares - 1;
+            return square;
+        }
+    }
+
+    Engine::Engine()
+    {
+        reset();
+    }
+
+    void
+    Engine::reset()
+    {
+        game_over_ = false;
+        player_turn_ = true;
+        black_ = START_BLACK;
+        white_ = START_WHITE;
+        kings_ = 0;
+        continuing_ = NO_SQUARE;
+        players_pieces_ = {12, 12};
+        last_pieces_ = players_pieces_;
+        moves_without_progress_ = 0;
+        win_ = false;
+        draw_ = false;
+    }
+
+    bool
+    Engine::isLegalMove(const Coordinate& from, const Coordinate& to) const
+    {
+        const uint8_t fromSquare = squareOf(from);
+        const uint8_t toSquare = squareOf(to);
+        if (fromSquare == NO_SQUARE || toSquare == NO_SQUARE) { return false; }
+
+        MoveList moves;
+        legalMoves(moves);
+        for (const Move& move : moves) {
+            if (move.from == fromSquare && move.to == toSquare) { return true; }
+        }
+        return false;
+    }
+
+    bool
+    Engine::move(const Coordinate& from, const Coordinate& to)
+    {
+        assert(isLegalMove(from, to));
+        const uint8_t fromSquare = squareOf(from);
+        const uint8_t toSquare = squareOf(to);
+
+        MoveList moves;
+        legalMoves(moves);
+        for (const Move& move : moves) {
+            if (move.from == fromSquare && move.to == toSquare) { return this->move(move); }
+        }
+        return false;
+    }
+
+    bool
+    Engine::move(const Move& move)
+    {
+        const mask_type from = bit(move.from);
+        const mask_type to = bit(move.to);
+        mask_type& side = player_turn_ ? black_ : white_;
+        side ^= from | to;
+        if (kings_ & from) { kings_ ^= from | to; }
+
+        if (move.captured != NO_SQUARE) {
+            const mask_type taken = bit(move.captured);
+            if (white_ & taken) { --players_pieces_.second; }
+            else { --players_pieces_.first; }
+            black_ &= ~taken;
+            white_ &= ~taken;
+            kings_ &= ~taken;
+        }
+
+        // A man on the far row is crowned and its move ends there
+        const bool promoted = (to & ~kings_ & (player_turn_ ? TOP_ROW : BOTTOM_ROW)) != 0;
+        if (promoted) { kings_ |= to; }
+
+        if (move.captured != NO_SQUARE && !promoted && canCapture(to)) {
+            continuing_ = move.to;
+            return false;
+        }
+        continuing_ = NO_SQUARE;
+        changePlayer();
+
+        // Check game status after each move
+        win_ = !canMove();
+        draw_ = !win_ && checkDraw();
+        game_over_ = win_ || draw_;
+        return true;
+    }
+
+    void
+    Engine::legalMoves(MoveList& moves) const
+    {
+        moves.clear();
+        const mask_type movers = continuing_ == NO_SQUARE ? own() : bit(continuing_);
+        captures(movers, moves);
+        if (moves.empty() && continuing_ == NO_SQUARE) { quietMoves(movers, moves); }
+    }
+
+    void
+    Engine::captures(const mask_type movers, MoveList& moves) const
+    {
+        const mask_type free = empty();
+        const mask_type opponents = opponent();
+
+        // Men: a whole side's jumps in one direction at a time, traced back from where they land
+        const mask_type men = movers & ~kings_;
+        for (const Direction direction : player_turn_ ? BLACK_FORWARD : WHITE_FORWARD) {
+            mask_type landings = step(step(men, direction) & opponents, direction) & free;
+            const Direction back = opposite(direction);
+            while (landings) {
+                const uint8_t to = pop(landings);
+                const mask_type captured = step(bit(to), back);
+                moves.push({uint8_t(__builtin_ctz(step(captured, back))), to, uint8_t(__builtin_ctz(captured))});
+            }
+        }
+
+        // Kings: slide over empty squares to the first piece, then land anywhere past it
+        mask_type kings = movers & kings_;
+        while (kings) {
+            const uint8_t from = pop(kings);
+            for (const Direction direction : ALL_DIRECTIONS) {
+                mask_type square = step(bit(from), direction);
+                while (square & free) { square = step(square, direction); }
+                if (!(square & opponents)) { continue; }
+
+                const uint8_t captured = uint8_t(__builtin_ctz(square));
+                for (square = step(square, direction); square & free; square = step(square, direction)) {
+                    moves.push({from, uint8_t(__builtin_ctz(square)), captured});
+                }
+            }
+        }
+    }
+
+    void
+    Engine::quietMoves(const mask_type movers, MoveList& moves) const
+    {
+        const mask_type free = empty();
+
+        const mask_type men = movers & ~kings_;
+        for (const Direction direction : player_turn_ ? BLACK_FORWARD : WHITE_FORWARD) {
+            mask_type targets = step(men, direction) & free;
+            const Direction back = opposite(direction);
+            while (targets) {
+                const uint8_t to = pop(targets);
+                moves.push({uint8_t(__builtin_ctz(step(bit(to), back))), to, NO_SQUARE});
+            }
+        }
+
+        mask_type kings = movers & kings_;
+        while (kings) {
+            const uint8_t from = pop(kings);
+            for (const Direction direction : ALL_DIRECTIONS) {
+                for (mask_type square = step(bit(from), direction) & free; square; square = step(square, direction) & free) {
+                    moves.push({from, uint8_t(__builtin_ctz(square)), NO_SQUARE});
+                }
+            }
+        }
+    }
+
+    bool
+    Engine::canCapture(const mask_type movers) const
+    {
+        const mask_type free = empty();
+        const mask_type opponents = opponent();
+
+        const mask_type men = movers & ~kings_;
+        for (const Direction direction : player_turn_ ? BLACK_FORWARD : WHITE_FORWARD) {
+            if (step(step(men, direction) & opponents, direction) & free) { return true; }
+        }
+
+        // Every king's ray advances together until it meets a piece
+        const mask_type kings = movers & kings_;
+        if (!kings) { return false; }
+        for (const Direction direction : ALL_DIRECTIONS) {
+            mask_type rays = step(kings, direction);
+            mask_type hits = 0;
+            while (rays) {
+                hits |= rays & opponents;
+                rays &= free;
+                rays = step(rays, direction);
+            }
+            if (step(hits, direction) & free) { return true; }
+        }
+        return false;
+    }
+
+    bool
+    Engine::canMove() const
+    {
+        const mask_type free = empty();
+        const mask_type pieces = own();
+        const mask_type men = pieces & ~kings_;
+        for (const Direction direction : player_turn_ ? BLACK_FORWARD : WHITE_FORWARD) {
+            if (step(men, direction) & free) { return true; }
+        }
+        for (const Direction direction : ALL_DIRECTIONS) {
+            if (step(pieces & kings_, direction) & free) { return true; }
+        }
+        return canCapture(pieces);
+    }
+
+    void
+    Engine::changePlayer()
+    {
+        player_turn_ = !player_turn_;
+    }
+
+    bool
+    Engine::checkDraw()
+    {
+        // Check for 20 moves without capture (simplified rule)
+        // If pieces were captured, reset counter
+        if (players_pieces_ != last_pieces_) {
+            moves_without_progress_ = 0;
+            last_pieces_ = players_pieces_;
+            return false;
+        }
+
+        // Increment counter and check for draw
+        if (++moves_without_progress_ >= MOVES_FOR_DRAW) { return true; }
+
+        // Only two kings left - automatic draw
+        const bool onlyKingsLeft = ((black_ | white_) & ~kings_) == 0;
+        return onlyKingsLeft && players_pieces_.first == 1 && players_pieces_.second == 1;
+    }
+
+    Engine::board_type
+    Engine::getBoard() const
+    {
+        board_type board;
+        for (uint8_t square = 0; square < SQUARES; ++square) { board(coordinateOf(square)) = getPiece(coordinateOf(square)); }
+        return board;
+    }
+
+    Engine::Piece
+    Engine::getPiece(const Coordinate& coord) const
+    {
+        const uint8_t square = squareOf(coord);
+        if (square == NO_SQUARE) { return Piece(EMPTY); }
+
+        const mask_type mask = bit(square);
+        const bool king = (kings_ & mask) != 0;
+        if (black_ & mask) { return Piece(king ? BLACK_KING : BLACK); }
+        if (white_ & mask) { return Piece(king ? WHITE_KING : WHITE); }
+        return Piece(EMPTY);
+    }
+
+    uint8_t
+    Engine::squareOf(const Coordinate& coord)
+    {
+        if (coord.x >= BOARD_SIZE || coord.y >= BOARD_SIZE || (coord.x + coord.y) % 2 == 0) { return NO_SQUARE; }
+        return uint8_t(coord.y * SQUARES_PER_ROW + coord.x / 2);
+    }
+
+    Engine::Coordinate
+    Engine::coordinateOf(const uint8_t square)
+    {
+        const size_t y = square / SQUARES_PER_ROW;
+        return Coordinate(2 * (square % SQUARES_PER_ROW) + (y + 1) % 2, y);
+    }
+
+    void
+    Engine::save(const std::string& path) const
+    {
+        Snapshot::save(path, SNAPSHOT_KIND, getBoard(), saveState());
+    }
+
+    void
+    Engine::load(const std::string& path)
+    {
+        const Snapshot::MappedBoard<Piece> snapshot(path, SNAPSHOT_KIND);
+        Snapshot::StateReader state = snapshot.getState();
+
+        board_type board;
+        Snapshot::restore(snapshot.getBoard(), board);
+        black_ = white_ = kings_ = 0;
+        for (uint8_t square = 0; square < SQUARES; ++square) {
+            const BoardElements value = board(coordinateOf(square)).value;
+            if (value == BLACK || value == BLACK_KING) { black_ |= bit(square); }
+            if (value == WHITE || value == WHITE_KING) { white_ |= bit(square); }
+            if (value == BLACK_KING || value == WHITE_KING) { kings_ |= bit(square); }
+        }
+        player_turn_ = state.get<bool>();
+        players_pieces_.first = state.get<int32_t>();
+        players_pieces_.second = state.get<int32_t>();
+        state.get<bool>();
+        win_ = state.get<bool>();
+        draw_ = state.get<bool>();
+        moves_without_progress_ = state.get<int32_t>();
+        continuing_ = NO_SQUARE;
+        // Snapshots are taken between turns, when the draw rule has caught up with the counts
+        last_pieces_ = players_pieces_;
+        game_over_ = win_ || draw_;
+    }
+
+    Snapshot::StateWriter
+    Engine::saveState() const
+    {
+        Snapshot::StateWriter state;
+        state.put(player_turn_);
+        state.put<int32_t>(players_pieces_.first);
+        state.put<int32_t>(players_pieces_.second);
+        state.put(game_over_);
+        state.put(win_);
+        state.put(draw_);
+        state.put<int32_t>(moves_without_progress_);
+        return state;
+    }
+}
@@ -0,0 +1,133 @@
+#ifndef __MINESWEEPER_ENGINE_HPP__
+#define __MINESWEEPER_ENGINE_HPP__
+
+#include "../resources/headers/Board.hpp"
+#include "../resources/headers/BitBoard.hpp"
+#include "../resources/headers/Snapshot.hpp"
+#include "../resources/headers/ThreadPool.hpp"
+
+#include <cstdint>
+#include <memory>
+#include <random>
+#include <string>
+#include <vector>
+
+namespace SamHovhannisyan::MinesweeperGame
+{
+    /// @brief Headless minesweeper rules
+    /// @details Owns the mine field and the player's progress and knows nothing about the
+    ///          terminal. Mines are laid on the first open() so that the first click is always
+    ///          safe, using the engine's own generator so seeded runs are reproducible.
+    class Engine
+    {
+    public:
+        enum BoardElements : int
+        {
+            EMPTY,
+            ONE,
+            TWO,
+            THREE,
+            FOUR,
+            FIVE,
+            SIX,
+            SEVEN,
+            EIGHT,
+            MINE,
+            FLAG
+        };
+
+        typedef Coordinate::Coordinate Coordinate;
+
+        /// @brief One packed byte per cell
+        /// @details The low four bits hold the number of neighbouring mines, the next three
+        ///          whether the cell is a mine, has been opened and carries a flag.
+        class Cell
+        {
+        public:
+            static constexpr uint8_t COUNT_MASK = 0x0F;
+            static constexpr uint8_t MINE_BIT = 0x10;
+            static constexpr uint8_t REVEALED_BIT = 0x20;
+            static constexpr uint8_t FLAG_BIT = 0x40;
+
+        public:
+            Cell(const uint8_t bits = 0) : bits_(bits) {}
+
+            uint8_t getCount() const { return bits_ & COUNT_MASK; }
+            bool isMine() const { return bits_ & MINE_BIT; }
+            bool isRevealed() const { return bits_ & REVEALED_BIT; }
+            bool isFlagged() const { return bits_ & FLAG_BIT; }
+            /// @brief What the cell holds: MINE or its neighbour count
+            BoardElements getElement() const { return isMine() ? MINE : BoardElements(getCount()); }
+
+            void setCount(const uint8_t count) { bits_ = (bits_ & ~COUNT_MASK) | (count & COUNT_MASK); }
+            void setMine(const bool mine) { set(MINE_BIT, mine); }
+            void setRevealed(const bool revealed) { set(REVEALED_BIT, revealed); }
+            void setFlagged(const bool flagged) { set(FLAG_BIT, flagged); }
+
+        private:
+            void set(const uint8_t bit, const bool value) { bits_ = value ? bits_ | bit : bits_ & ~bit; }
+
+        private:
+            uint8_t bits_;
+        };
+
+        typedef Cell cell_type;
+        typedef Board::Board<cell_type> board_type;
+
+        static const uint32_t SNAPSHOT_KIND;
+
+    public:
+        Engine(const size_t width = 16, const size_t height = 16, const uint32_t seed = std::random_device()());
+
+        /// @brief Start a new game on a board of the same size
+        void reset();
+        /// @brief Open a cell; the first call also lays the mines
+        /// @details Coordinates outside the board and flagged cells are ignored.
+        void open(const Coordinate& coord);
+        /// @brief Place or remove a flag on a closed cell; ignored before the first open
+        void toggleFlag(const Coordinate& coord);
+
+        bool isGameOver() const { return game_over_; }
+        /// @brief Every safe cell is open; a counter, so O(1)
+        bool isWin() const { return closed_safe_ == 0; }
+        bool isFirstClick() const { return first_click_; }
+        bool isFlagged(const Coordinate& coord) const { return board_(coord).isFlagged(); }
+        size_t getMinesCount() const { return mines_count_; }
+        size_t getFlagsPlaced() const { return flags_placed_; }
+        const board_type& getBoard() const { return board_; }
+
+        /// @brief Dirty cell tracking of the board, for incremental renderers
+        void setDirtyTracking(const bool enabled) { board_.setDirtyTracking(enabled); }
+        void clearDirty() { board_.clearDirty(); }
+
+        void save(const std::string& path) const;
+        void load(const std::string& path);
+        Snapshot::StateWriter saveState() const;
+
+    private:
+        void generateMines(const Coordinate& coord);
+        void placeBombs(const BitBoard::BitBoard& mines);
+        void placeRemoveFlag(const Coordinate& coord);
+        void openEmptysFrom(const Coordinate& coord);
+        void openCell(const Coordinate& coord);
+        void revealAllMines();
+        /// @brief Rebuild the safe-cell counter and the mine list from the board
+        void countCells();
+
+    private:
+        board_type board_;
+        bool first_click_;
+        bool game_over_;
+        size_t mines_count_;
+        size_t flags_placed_;
+        /// @brief Safe cells not opened yet; before the mines are laid every cell counts
+        size_t closed_safe_;
+        /// @brief Board indices of the mines, so a loss reveals them without a board scan
+        std::vector<size_t> mines_;
+        std::mt19937 random_;
+        /// @brief Started on the first flood fill large enough to run in parallel
+        std::shared_ptr<ThreadPool::ThreadPool> pool_;
+    };
+}
+
+#endif // __MINESWEEPER_ENGINE_HPP__
@@ -0,0 +1,35 @@
+#ifndef __MINESWEEPER_FLOOD_HPP__
+#define __MINESWEEPER_FLOOD_HPP__
+
+#include "../headers/Engine.hpp"
+#include "../resources/headers/ThreadPool.hpp"
+
+#include <cstddef>
+
+/// @brief Namespace for the minesweeper flood fill
+/// @details Opening a cell with no neighbouring mine opens the 8-connected region of such cells
+///          and the numbered cells around it. Flagged cells are never opened and the fill does
+///          not pass through them. Both fills below open the same cells; they differ in how the
+///          work is scheduled.
+/// @namespace Flood
+namespace SamHovhannisyan::MinesweeperGame::Flood
+{
+    /// @brief Scanline fill from an open cell with no neighbouring mine
+    /// @details Works on runs of consecutive empty cells in one row instead of single cells:
+    ///          a run is grown left and right over the linear index, opened, and the rows above
+    ///          and below are scanned once over its extent for the next runs. The stack holds
+    ///          one small entry per run. Every opened cell goes through the board's dirty
+    ///          tracking.
+    /// @return The number of cells opened, start excluded
+    size_t reveal(Engine::board_type& board, const Coordinate::Coordinate& start);
+
+    /// @brief The same fill over horizontal bands of rows flooded in parallel
+    /// @details Each band only reads and writes its own rows. A run on the edge row of a band
+    ///          hands the scan of the row beyond to the neighbouring band, and the bands flood
+    ///          in rounds until no band has work left, so threads never share a cell. The whole
+    ///          board is marked dirty.
+    /// @return The number of cells opened, start excluded
+    size_t revealBanded(Engine::board_type& board, const Coordinate::Coordinate& start, ThreadPool::ThreadPool& pool);
+}
+
+#endif // __MINESWEEPER_FLOOD_HPP__
@@ -1,10 +1,14 @@
 #ifndef __MINESWEEPER_HPP__
 #define __MINESWEEPER_HPP__
 
-#include "../resources/headers/Board.hpp"
+#include "../headers/Engine.hpp"
+#include "../headers/Generator.hpp"
+#include "../headers/Heatmap.hpp"
+#include "../resources/headers/Viewport.hpp"
 
-#include <algorithm>
-#include <random>
+#include <memory>
+#include <string>
+#include <vector>
 
 namespace SamHovhannisyan::MinesweeperGame
 {
@@ -15,43 +19,40 @@ namespace SamHovhannisyan::MinesweeperGame
     public:
         Minesweeper(const size_t width = 16, const size_t height = 16);
         void start();
+        void save(const std::string& path) const;
+        void load(const std::string& path);
+        void setCheckpoint(const std::string& path);
+        /// @brief Lay the mines on the first click so the game never needs a guess
+        void setNoGuess(const bool enabled);
+        /// @brief Show the mine probability of every closed cell, computed in the background
+        void setHeatmap(const bool enabled);
     
     private:
-        enum BoardElements : int
-        {
-            EMPTY,
-            ONE,
-            TWO,
-            THREE,
-            FOUR,
-            FIVE,
-            SIX,
-            SEVEN,
-            EIGHT,
-            MINE,
-            FLAG
-        };
-    
-    private:
-        void drawBoard() const;
-        void generateMines(const Coordinate& coord);
-        void placeBomb(const size_t pos);
-        void placeRemoveFlag(const Coordinate& coord);
-        std::vector<SamHovhannisyan::MinesweeperGame::Minesweeper::Coordinate>::const_iterator getFlag(const Coordinate& coord) const;
+        void drawBoard();
+        /// @brief Fit the viewport to the board and the terminal as they are now
+        void layout();
+        void drawCell(const Coordinate& coord) const;
+        /// @brief Move the keyboard cursor, scrolling the board to keep it in view
+        void moveCursor(const long dy, const long dx);
         const Coordinate handleInput();
-        void checkCollision();
-        bool checkWin() const;
-        void openEmptysFrom(const Coordinate& coord);
-        void openCell(const Coordinate& coord);
-        void revealAllMines();
+        void openNoGuess(const Coordinate& coord);
+        void requestHeatmap();
 
     private:
-        Board::Board<std::pair<BoardElements, bool>> board_;
-        std::vector<Coordinate> flags_;
-        bool first_click_;
-        bool game_over_;
-        size_t mines_count_;
-        size_t flags_placed_;
+        Engine engine_;
+        bool quit_;
+        std::string checkpoint_;
+        Snapshot::Writer writer_;
+        Coordinate hovered_;
+        bool hoverDrawn_;
+        std::unique_ptr<Generator> generator_;
+        std::unique_ptr<Heatmap> heatmap_;
+        std::vector<float> probabilities_;
+        /// @brief The overlay changed, so every closed cell is drawn again
+        bool heatmapChanged_;
+        Viewport::Viewport viewport_;
+        /// @brief The window moved or the terminal was resized, so every visible cell is drawn again
+        bool redraw_;
     };
 }    
 
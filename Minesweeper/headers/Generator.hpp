@@ -0,0 +1,46 @@
+#ifndef __MINESWEEPER_GENERATOR_HPP__
+#define __MINESWEEPER_GENERATOR_HPP__
+
+#include "../headers/Engine.hpp"
+#include "../resources/headers/WorkStealingPool.hpp"
+
+#include <cstdint>
+
+namespace SamHovhannisyan::MinesweeperGame
+{
+    /// @brief Games that can be won from the first click without guessing
+    /// @details Candidate k is the layout the engine itself lays for a seed derived from the
+    ///          requested seed and k, so a candidate is identified by a number alone. Every
+    ///          candidate is played by the Solver from the first click; one the solver wins is
+    ///          solvable without a guess. Candidates run as tasks on a work-stealing pool,
+    ///          each one queueing the next before it starts solving, and the first solvable
+    ///          candidate cancels the others. Which solvable candidate wins the race depends
+    ///          on the timing of the threads.
+    class Generator
+    {
+    public:
+        typedef Coordinate::Coordinate Coordinate;
+
+        static constexpr size_t DEFAULT_CANDIDATES = 100000;
+
+    public:
+        /// @brief Constructor
+        /// @details threads = 0 uses one thread per hardware core.
+        Generator(const size_t threads = 0);
+
+        /// @brief A game with the first click at first already played and no guess needed
+        /// @details width and height are passed on to the Engine constructor. Throws
+        ///          std::runtime_error if none of maxCandidates layouts can be solved.
+        Engine generate(const size_t width, const size_t height, const Coordinate& first, const uint32_t seed,
+                        const size_t maxCandidates = DEFAULT_CANDIDATES);
+
+        /// @brief Candidates solved by the last call, the winning one included
+        size_t getCandidates() const { return candidates_; }
+
+    private:
+        WorkStealingPool::WorkStealingPool pool_;
+        size_t candidates_;
+    };
+}
+
+#endif // __MINESWEEPER_GENERATOR_HPP__
@@ -0,0 +1,60 @@
+#ifndef __MINESWEEPER_HEATMAP_HPP__
+#define __MINESWEEPER_HEATMAP_HPP__
+
+#include "../headers/Engine.hpp"
+#include "../headers/Probability.hpp"
+
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace SamHovhannisyan::MinesweeperGame
+{
+    /// @brief Mine probabilities computed on a background thread
+    /// @details request() copies what the player sees of the board and returns at once; a
+    ///          computation still running for an older request is cancelled, a result for it
+    ///          not taken yet is dropped, and the worker starts over on the new one. poll() hands over the newest finished result
+    ///          without waiting. The UI thread only ever takes the lock to swap a request or
+    ///          a result in or out.
+    class Heatmap
+    {
+    public:
+        Heatmap();
+        Heatmap(const Heatmap&) = delete;
+        Heatmap& operator=(const Heatmap&) = delete;
+        ~Heatmap();
+
+        /// @brief Start over on the current position of engine
+        void request(const Engine& engine);
+        /// @brief Take the newest result, if one came in since the last call
+        /// @details probabilities gets one Probability::NONE or value in 0 .. 1 per cell.
+        bool poll(std::vector<float>& probabilities);
+
+    private:
+        void run();
+
+    private:
+        std::thread thread_;
+        std::mutex mutex_;
+        std::condition_variable wake_;
+        bool stop_;
+        std::atomic<bool> cancel_;
+
+        /// @brief The latest request and the latest result, guarded by mutex_
+        std::vector<int8_t> view_;
+        size_t rows_;
+        size_t cols_;
+        size_t mines_;
+        uint64_t requested_;
+        std::vector<float> result_;
+        bool ready_;
+
+        /// @brief Only used by the worker
+        Probability probability_;
+    };
+}
+
+#endif // __MINESWEEPER_HEATMAP_HPP__
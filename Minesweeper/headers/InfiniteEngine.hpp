@@ -0,0 +1,97 @@
+#ifndef __MINESWEEPER_INFINITE_ENGINE_HPP__
+#define __MINESWEEPER_INFINITE_ENGINE_HPP__
+
+#include "../headers/Engine.hpp"
+#include "../resources/headers/ChunkedBoard.hpp"
+
+#include <bitset>
+#include <cstdint>
+#include <random>
+#include <unordered_map>
+
+namespace SamHovhannisyan::MinesweeperGame
+{
+    /// @brief Headless minesweeper rules on a board without edges in practice
+    /// @details The board is 2^38 cells on a side and the game starts in its middle. Whether a
+    ///          cell is a mine is a hash of the seed, its chunk and its place in the chunk, so
+    ///          any cell can be asked for in O(1) without laying the rest of the board. A chunk
+    ///          is built (mines and numbers) the first time a click, a flood fill or a read
+    ///          reaches it, and at most a fixed number of chunks stay resident. An evicted chunk
+    ///          keeps only what the player changed, its open and flagged cells, and is rebuilt
+    ///          bit for bit when it is reached again. Memory and time therefore follow the area
+    ///          explored, not the size of the board. As with the Engine, no mine is laid near the
+    ///          first click. There is no win: the score is the number of cells opened.
+    class InfiniteEngine
+    {
+    public:
+        typedef Coordinate::Coordinate Coordinate;
+        typedef Engine::Cell cell_type;
+
+        static constexpr size_t CHUNK_SIZE = 64;
+        typedef Board::ChunkedBoard<cell_type, CHUNK_SIZE> board_type;
+        typedef board_type::tile_key chunk_key;
+
+        /// @brief Cells on a side: the most chunks a board_type key can address
+        static constexpr size_t SIDE = CHUNK_SIZE << 32;
+        /// @brief Resident chunks kept by default, 16 MiB of cells
+        static constexpr size_t DEFAULT_CHUNKS = 4096;
+
+    public:
+        InfiniteEngine(const uint64_t seed = std::random_device()(), const size_t chunks = DEFAULT_CHUNKS);
+        InfiniteEngine(const InfiniteEngine&) = delete;
+        InfiniteEngine& operator=(const InfiniteEngine&) = delete;
+
+        /// @brief Start a new game on the same layout
+        void reset();
+        /// @brief Open a cell; ignored outside the board and on flags
+        void open(const Coordinate& coord);
+        /// @brief Place or remove a flag on a closed cell; ignored before the first open
+        void toggleFlag(const Coordinate& coord);
+
+        /// @brief The cell at coord, building its chunk if it is not resident
+        cell_type getCell(const Coordinate& coord) const { return board_(coord); }
+        /// @brief Whether coord is a mine, straight from the hash
+        bool isMine(const Coordinate& coord) const;
+
+        bool isGameOver() const { return game_over_; }
+        bool isFirstClick() const { return first_click_; }
+        uint64_t getSeed() const { return seed_; }
+        /// @brief Where the game starts, the middle of the board
+        static Coordinate getOrigin() { return Coordinate(SIDE / 2, SIDE / 2); }
+        size_t getOpened() const { return opened_; }
+        size_t getFlagsPlaced() const { return flags_placed_; }
+        /// @brief Chunks built since the engine was created, rebuilds included
+        size_t getChunksBuilt() const { return built_; }
+        size_t getChunksResident() const { return board_.getTileCount(); }
+        /// @brief Evicted chunks whose open and flagged cells are kept
+        size_t getChunksSaved() const { return saved_.size(); }
+        void setChunkCapacity(const size_t chunks) { board_.setCapacity(chunks); }
+
+    private:
+        /// @brief What the player changed in one chunk
+        struct Progress
+        {
+            std::bitset<CHUNK_SIZE * CHUNK_SIZE> revealed;
+            std::bitset<CHUNK_SIZE * CHUNK_SIZE> flagged;
+        };
+
+        uint64_t seedOf(const chunk_key key) const;
+        bool isMine(const uint64_t chunkSeed, const size_t x, const size_t y) const;
+        void build(const chunk_key key, board_type::Tile& tile);
+        void keep(const chunk_key key, const board_type::Tile& tile);
+        void openEmptysFrom(const Coordinate& coord);
+
+    private:
+        uint64_t seed_;
+        board_type board_;
+        std::unordered_map<chunk_key, Progress> saved_;
+        bool first_click_;
+        bool game_over_;
+        Coordinate first_;
+        size_t opened_;
+        size_t flags_placed_;
+        size_t built_;
+    };
+}
+
+#endif // __MINESWEEPER_INFINITE_ENGINE_HPP__
@@ -0,0 +1,34 @@
+#ifndef __MINESWEEPER_INFINITE_GAME_HPP__
+#define __MINESWEEPER_INFINITE_GAME_HPP__
+
+#include "../headers/InfiniteEngine.hpp"
+
+namespace SamHovhannisyan::MinesweeperGame
+{
+    /// @brief Terminal front-end of the endless board
+    /// @details Shows the part of the board under the camera, which the arrow keys move; only
+    ///          the chunks on screen and those the player opened are ever built.
+    class InfiniteMinesweeper
+    {
+    public:
+        typedef Coordinate::Coordinate Coordinate;
+    public:
+        InfiniteMinesweeper();
+        void start();
+
+    private:
+        void drawBoard() const;
+        void drawCell(const Coordinate& coord, const int row, const int column) const;
+        void handleInput();
+        /// @brief Put the camera so that the start of the game is in the middle of the screen
+        void center();
+
+    private:
+        InfiniteEngine engine_;
+        bool quit_;
+        /// @brief The board cell shown in the top left corner
+        Coordinate camera_;
+    };
+}
+
+#endif // __MINESWEEPER_INFINITE_GAME_HPP__
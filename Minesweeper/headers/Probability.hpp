@@ -0,0 +1,111 @@
+#ifndef __MINESWEEPER_PROBABILITY_HPP__
+#define __MINESWEEPER_PROBABILITY_HPP__
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace SamHovhannisyan::MinesweeperGame
+{
+    /// @brief Exact mine probability of every closed cell, from what a player can see
+    /// @details The closed cells next to open numbers are split into components that share no
+    ///          number. Each component is enumerated once by backtracking, counting its
+    ///          solutions by the number of mines they use and, per cell, the solutions where
+    ///          the cell is a mine. The components are then combined with the closed cells no
+    ///          number touches: a way to place m mines on the frontier leaves the remaining
+    ///          mines to those cells, C(rest, mines - m) ways, which weighs every frontier
+    ///          configuration by the mine count. Cells the single-cell rule decides (a number
+    ///          already satisfied, or with as many closed cells as missing mines) are settled
+    ///          first, which cuts long frontiers into small components. Polynomials are kept
+    ///          as doubles scaled to a maximum of 1, since only ratios matter.
+    ///          A component is identified by its cells and numbers, so one a click did not
+    ///          change is taken from the cache instead of enumerated again. A component too
+    ///          large to enumerate counts as cells no number touches, so its probabilities and
+    ///          those of the unconstrained cells are approximate in that case.
+    class Probability
+    {
+    public:
+        /// @brief A closed cell in a view; an open one holds its number
+        static constexpr int8_t CLOSED = -1;
+        /// @brief The probability of a cell that is open, or that could not be computed
+        static constexpr float NONE = -1;
+        static constexpr size_t MAX_COMPONENT = 48;
+        static constexpr size_t MAX_NODES = size_t(1) << 22;
+
+    public:
+        Probability();
+
+        /// @brief Probabilities of the cells of view, row by row
+        /// @details mines is the number of mines on the whole board. Returns false and leaves
+        ///          out unspecified if cancel was raised before the end.
+        bool compute(const std::vector<int8_t>& view, const size_t rows, const size_t cols, const size_t mines,
+                     const std::atomic<bool>& cancel, std::vector<float>& out);
+
+        /// @brief Components the last compute() enumerated, and those it found in the cache
+        size_t getEnumerated() const { return enumerated_; }
+        size_t getCached() const { return cached_; }
+        /// @brief Cells of the components too large to enumerate in the last compute()
+        size_t getUnsolved() const { return unsolved_; }
+
+    private:
+        enum Knowledge : uint8_t
+        {
+            UNKNOWN,
+            SAFE,
+            MINE
+        };
+
+        /// @brief Solution counts of one component, by number of mines
+        struct Component
+        {
+            /// @brief Solutions using k mines, at k
+            std::vector<double> solutions;
+            /// @brief Per variable, solutions using k mines where it is a mine, at k
+            std::vector<double> mines;
+            bool solved;
+            uint64_t used;
+        };
+
+        size_t neighbours(const uint32_t cell, uint32_t* out) const;
+        bool isVariable(const std::vector<int8_t>& view, const uint32_t cell) const;
+        /// @brief The mines around an open cell not settled yet
+        int missing(const std::vector<int8_t>& view, const uint32_t number) const;
+        /// @brief Apply the single-cell rule until nothing changes
+        /// @return The number of mines settled
+        size_t settle(const std::vector<int8_t>& view);
+        /// @brief Collect the component holding start, breadth first from its smallest cell
+        void collect(const std::vector<int8_t>& view, const uint32_t start);
+        /// @brief The counts of the collected component, from the cache or enumerated
+        /// @return nullptr if cancelled
+        const Component* solve(const std::vector<int8_t>& view, const std::atomic<bool>& cancel);
+        bool search(const size_t variable, const size_t mines, const std::atomic<bool>& cancel);
+
+    private:
+        size_t rows_;
+        size_t cols_;
+        std::unordered_map<std::string, Component> cache_;
+        uint64_t now_;
+        size_t enumerated_;
+        size_t cached_;
+        size_t unsolved_;
+
+        std::vector<uint8_t> known_;
+        /// @brief The component being collected and enumerated
+        std::vector<uint32_t> variables_;
+        std::vector<uint32_t> constraints_;
+        std::vector<uint32_t> slot_;
+        std::vector<uint8_t> seen_;
+        std::vector<uint32_t> scope_;
+        std::vector<uint8_t> scopeSize_;
+        std::vector<int> missing_;
+        std::vector<int> open_;
+        std::vector<uint8_t> assignment_;
+        Component* current_;
+        size_t nodes_;
+    };
+}
+
+#endif // __MINESWEEPER_PROBABILITY_HPP__
@@ -0,0 +1,120 @@
+#ifndef __MINESWEEPER_SOLVER_HPP__
+#define __MINESWEEPER_SOLVER_HPP__
+
+#include "../headers/Engine.hpp"
+
+#include <cstdint>
+#include <vector>
+
+namespace SamHovhannisyan::MinesweeperGame
+{
+    /// @brief Deduces safe cells and mines from what a player can see
+    /// @details Only open cells and their numbers are read; mines under closed cells and the
+    ///          player's flags are never looked at. Every open number is a constraint on its
+    ///          closed neighbours, and three rules are tried from cheapest to most expensive:
+    ///          1. single cell: a number already satisfied makes the rest safe, a number with
+    ///             as many closed neighbours as missing mines makes them all mines;
+    ///          2. subset: when the closed neighbours of one number are a subset of those of a
+    ///             number within two cells, the difference holds the difference of the counts;
+    ///          3. enumeration: the closed cells next to open numbers are split into components
+    ///             that share no number, and each component is solved exactly by backtracking.
+    ///             A cell that is a mine in every solution is a mine, in none it is safe.
+    ///          The solver is incremental: opened() learns the cells a click opened and queues
+    ///          only the numbers around them, and a component is enumerated again only when
+    ///          one of its numbers changed since the last time.
+    class Solver
+    {
+    public:
+        typedef Coordinate::Coordinate Coordinate;
+
+        /// @brief What the solver knows about a cell
+        enum Knowledge : uint8_t
+        {
+            UNKNOWN,
+            SAFE,
+            MINE,
+            OPEN
+        };
+
+        /// @brief Components with more closed cells are left for later, when numbers split them
+        static constexpr size_t MAX_COMPONENT = 48;
+        /// @brief Search nodes one component may cost before it is given up
+        static constexpr size_t MAX_NODES = size_t(1) << 20;
+
+    public:
+        /// @brief Constructor
+        /// @details Sizes the solver for the board of engine; it can then follow any game on a
+        ///          board of that shape.
+        Solver(const Engine& engine);
+
+        /// @brief Forget everything, for a new game
+        void reset();
+        /// @brief Learn the cells opened by a click on coord, flood-filled ones included
+        void opened(const Engine& engine, const Coordinate& coord);
+        /// @brief Apply the rules until a closed safe cell is known or nothing more follows
+        /// @return Whether nextSafe() has a cell
+        bool solve(const Engine& engine);
+        /// @brief Pop a cell known to be safe and still closed
+        bool nextSafe(Coordinate& coord);
+        /// @brief Open deduced safe cells until the game ends or a guess would be needed
+        /// @return The number of cells opened
+        size_t play(Engine& engine);
+
+        Knowledge getKnowledge(const Coordinate& coord) const { return Knowledge(state_[coord.y * cols_ + coord.x]); }
+        /// @brief Safe cells and mines deduced since the last reset
+        size_t getDeduced() const { return deduced_; }
+
+    private:
+        typedef uint32_t cell_type;
+
+        /// @brief Drop deduced safe cells opened since, and tell whether any is left
+        bool hasSafe();
+        size_t neighbours(const cell_type cell, cell_type* out) const;
+        /// @brief The closed neighbours of an open cell not known yet, and the mines among them
+        size_t unknowns(const Engine& engine, const cell_type cell, cell_type* out, int& missing) const;
+
+        void queue(const cell_type cell);
+        void changed(const cell_type cell);
+        void mark(const cell_type cell, const Knowledge knowledge);
+        void markAll(const cell_type* cells, const size_t count, const Knowledge knowledge);
+
+        bool propagate(const Engine& engine);
+        bool subsets(const Engine& engine, const cell_type cell, const cell_type* unknown, const size_t count, const int missing);
+        bool enumerate(const Engine& engine);
+        bool solveComponent(const Engine& engine, const cell_type start);
+        void search(const size_t variable, size_t& nodes);
+
+    private:
+        size_t cols_;
+        size_t rows_;
+        std::vector<uint8_t> state_;
+        /// @brief Open cells whose closed neighbours changed, to run the local rules on
+        std::vector<cell_type> queue_;
+        std::vector<uint8_t> queued_;
+        /// @brief Closed cells whose component changed since it was last enumerated
+        std::vector<cell_type> touched_;
+        std::vector<uint8_t> changed_;
+        /// @brief Deduced safe cells, possibly opened since by a flood fill
+        std::vector<cell_type> safe_;
+        size_t deduced_;
+
+        /// @brief Enumeration of one component: its cells and numbers, in search order
+        std::vector<cell_type> stamp_;
+        cell_type stampNow_;
+        std::vector<cell_type> variables_;
+        std::vector<cell_type> constraints_;
+        /// @brief Index of a cell among variables_ or constraints_, valid while stamped
+        std::vector<cell_type> slot_;
+        /// @brief For every variable, the constraints it appears in, 8 slots per variable
+        std::vector<cell_type> scope_;
+        std::vector<uint8_t> scopeSize_;
+        /// @brief Per constraint: mines still missing, and variables not assigned yet
+        std::vector<int> missing_;
+        std::vector<int> open_;
+        std::vector<uint8_t> assignment_;
+        std::vector<uint64_t> mineSolutions_;
+        uint64_t solutions_;
+    };
+}
+
+#endif // __MINESWEEPER_SOLVER_HPP__
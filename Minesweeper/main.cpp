@@ -1,10 +1,42 @@
 #include "headers/Game.hpp"
+#include "headers/InfiniteGame.hpp"
+
+#include <ncurses.h>
+#include <cstring>
+#include <iostream>
+#include <unistd.h>
 
 int 
-main()
+main(int argc, char** argv)
 {
+    // --infinite: an endless board, built around the player as it is explored
+    for (int i = 1; i < argc; ++i) {
+        if (std::strcmp(argv[i], "--infinite") != 0) { continue; }
+        SamHovhannisyan::MinesweeperGame::InfiniteMinesweeper game;
+        game.start();
+        return 0;
+    }
+
     SamHovhannisyan::MinesweeperGame::Minesweeper game;
+
+    // --no-guess: lay the mines on the first click so that no guess is ever needed
+    // --heatmap: start with the mine probabilities shown ('h' toggles them in game)
+    for (int i = 1; i < argc; ++i) {
+        if (std::strcmp(argv[i], "--no-guess") == 0) { game.setNoGuess(true); }
+        if (std::strcmp(argv[i], "--heatmap") == 0) { game.setHeatmap(true); }
+    }
+
+    // --checkpoint <file>: resume from the file if it exists and keep saving to it
+    for (int i = 1; i + 1 < argc; ++i) {
+        if (std::strcmp(argv[i], "--checkpoint") != 0) { continue; }
+        if (access(argv[i + 1], F_OK) == 0) {
+            try { game.load(argv[i + 1]); }
+            catch (const std::exception& e) { endwin(); std::cerr << e.what() << std::endl; return 1; }
+        }
+        game.setCheckpoint(argv[i + 1]);
+    }
+
     game.start();
 
     return 0;
-}
\ No newline at end of file
+}
@@ -0,0 +1,312 @@
+#include "headers/Engine.hpp"
+#include "headers/Flood.hpp"
+#include "headers/Generator.hpp"
+#include "headers/InfiniteEngine.hpp"
+#include "headers/Probability.hpp"
+#include "headers/Solver.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <queue>
+#include <random>
+
+namespace
+{
+    typedef std::chrono::steady_clock clock_type;
+    typedef SamHovhannisyan::MinesweeperGame::Engine Engine;
+    typedef SamHovhannisyan::MinesweeperGame::Solver Solver;
+    typedef SamHovhannisyan::MinesweeperGame::Generator Generator;
+    typedef SamHovhannisyan::MinesweeperGame::InfiniteEngine InfiniteEngine;
+    typedef SamHovhannisyan::MinesweeperGame::Probability Probability;
+    namespace BitBoard = SamHovhannisyan::BitBoard;
+    namespace Flood = SamHovhannisyan::MinesweeperGame::Flood;
+    namespace ThreadPool = SamHovhannisyan::ThreadPool;
+
+    /// A closed square field with 1% mines, so nearly all of it is one empty region
+    Engine::board_type
+    openField(const size_t side)
+    {
+        std::mt19937 random(1);
+        BitBoard::BitBoard mines(side, side);
+        for (size_t i = 0; i < side * side / 100; ++i) { mines.set({ random() % side, random() % side }); }
+
+        Engine::board_type board(side, side);
+        mines.neighbourCounts(reinterpret_cast<uint8_t*>(board.data()));
+        for (size_t i = 0; i < board.size(); ++i) { board[i].setMine(mines(board.coordinateOf(i))); }
+        return board;
+    }
+
+    /// The per-cell BFS the engine used before the scanline fill, kept as the baseline
+    size_t
+    revealBfs(Engine::board_type& board, const Engine::Coordinate& start)
+    {
+        size_t opened = 0;
+        std::queue<Engine::Coordinate> to_open;
+        to_open.push(start);
+        while (!to_open.empty()) {
+            const Engine::Coordinate current = to_open.front();
+            to_open.pop();
+            for (int dy = -1; dy <= 1; ++dy) {
+                for (int dx = -1; dx <= 1; ++dx) {
+                    const size_t nx = current.x + dx;
+                    const size_t ny = current.y + dy;
+                    if ((dx == 0 && dy == 0) || nx >= board.getCols() || ny >= board.getRows()) { continue; }
+                    if (board.getBoard()({nx, ny}).isRevealed()) { continue; }
+                    Engine::Cell& neighbor = board({nx, ny});
+                    neighbor.setRevealed(true);
+                    ++opened;
+                    if (neighbor.getElement() == Engine::EMPTY) { to_open.push({nx, ny}); }
+                }
+            }
+        }
+        return opened;
+    }
+
+    /// Open every safe cell of the square of the given side around the start, row by row
+    void
+    explore(InfiniteEngine& engine, const size_t side)
+    {
+        const InfiniteEngine::Coordinate origin = InfiniteEngine::getOrigin();
+        engine.open(origin);
+        for (size_t y = origin.y - side / 2; y < origin.y + side / 2; ++y) {
+            for (size_t x = origin.x - side / 2; x < origin.x + side / 2; ++x) {
+                if (!engine.isMine({ x, y })) { engine.open({ x, y }); }
+            }
+        }
+    }
+
+    /// Totals of the solver autoplay over every thread
+    struct Autoplay
+    {
+        std::atomic<size_t> wins{0};
+        std::atomic<size_t> cleanWins{0};
+        std::atomic<size_t> guesses{0};
+        std::atomic<size_t> decisions{0};
+    };
+
+    /// Play seeded games with the solver, guessing a random unknown cell only when it is stuck
+    void
+    autoplay(const size_t width, const size_t height, const size_t begin, const size_t end, Autoplay& totals)
+    {
+        Engine engine(width, height, 0);
+        Solver solver(engine);
+        std::vector<size_t> unknown;
+        size_t wins = 0;
+        size_t cleanWins = 0;
+        size_t guesses = 0;
+        size_t decisions = 0;
+        for (size_t game = begin; game < end; ++game) {
+            engine = Engine(width, height, game);
+            solver.reset();
+            std::mt19937 random(game);
+            const Engine::board_type& board = engine.getBoard();
+            Engine::Coordinate coord(board.getCols() / 2, board.getRows() / 2);
+            size_t guessed = 0;
+
+            while (true) {
+                engine.open(coord);
+                solver.opened(engine, coord);
+                solver.play(engine);
+                if (engine.isGameOver()) { break; }
+
+                unknown.clear();
+                for (size_t i = 0; i < board.size(); ++i) {
+                    if (solver.getKnowledge(board.coordinateOf(i)) == Solver::UNKNOWN) { unknown.push_back(i); }
+                }
+                coord = board.coordinateOf(unknown[random() % unknown.size()]);
+                ++guessed;
+            }
+
+            wins += engine.isWin();
+            cleanWins += engine.isWin() && guessed == 0;
+            guesses += guessed;
+            decisions += solver.getDeduced();
+        }
+        totals.wins += wins;
+        totals.cleanWins += cleanWins;
+        totals.guesses += guesses;
+        totals.decisions += decisions;
+    }
+}
+
+/// Headless throughput of the minesweeper rules: random clicks on closed cells, no terminal
+int
+main()
+{
+    const size_t GAMES = 2000;
+
+    std::printf("%8s %8s %10s %8s %12s\n", "board", "games", "clicks", "wins", "games/s");
+    for (const size_t side : { 9, 16, 30, 100 }) {
+        Engine engine(side, side, 1);
+        std::mt19937 random(1);
+        std::uniform_int_distribution<size_t> pick(0, side - 1);
+        size_t clicks = 0;
+        size_t wins = 0;
+
+        const clock_type::time_point start = clock_type::now();
+        for (size_t game = 0; game < GAMES; ++game) {
+            engine.reset();
+            while (!engine.isGameOver()) {
+                const Engine::Coordinate coord(pick(random), pick(random));
+                if (engine.getBoard()(coord).isRevealed()) { continue; }
+                engine.open(coord);
+                ++clicks;
+            }
+            wins += engine.isWin();
+        }
+        const std::chrono::duration<double> elapsed = clock_type::now() - start;
+
+        std::printf("%5zux%-3zu %8zu %10zu %8zu %12.0f\n", side, side, GAMES, clicks, wins, GAMES / elapsed.count());
+    }
+
+    // One click opening a region of a million cells and more
+    std::printf("\n%12s %10s %10s %10s %10s\n", "board", "opened", "bfs ms", "scan ms", "banded ms");
+    ThreadPool::ThreadPool pool;
+    for (const size_t side : { 1000, 2000, 4000 }) {
+        const Engine::board_type field = openField(side);
+        Engine::Coordinate start(0, 0);
+        while (field(start).getElement() != Engine::EMPTY) { ++start.x; }
+
+        double elapsed[3];
+        size_t opened[3];
+        for (size_t method = 0; method < 3; ++method) {
+            Engine::board_type board = field;
+            board(start).setRevealed(true);
+            const clock_type::time_point begin = clock_type::now();
+            opened[method] = method == 0 ? revealBfs(board, start)
+                           : method == 1 ? Flood::reveal(board, start)
+                           : Flood::revealBanded(board, start, pool);
+            elapsed[method] = std::chrono::duration<double, std::milli>(clock_type::now() - begin).count();
+        }
+        std::printf("%6zux%-5zu %10zu %10.1f %10.1f %10.1f%s\n", side, side, opened[1], elapsed[0], elapsed[1], elapsed[2],
+                    opened[0] == opened[1] && opened[1] == opened[2] ? "" : "  MISMATCH");
+    }
+
+    // The solver playing seeded games on every core; decisions are cells it deduced
+    std::printf("\n%8s %9s %8s %8s %9s %10s %12s\n", "board", "games", "won %", "clean %", "guesses", "games/s", "decisions/s");
+    const size_t SOLVER_GAMES[][3] = { { 9, 9, 1000000 }, { 16, 16, 100000 }, { 30, 16, 50000 } };
+    for (const auto& setup : SOLVER_GAMES) {
+        Autoplay totals;
+        const clock_type::time_point begin = clock_type::now();
+        pool.parallelFor(setup[2], [&setup, &totals](const size_t first, const size_t last) {
+            autoplay(setup[0], setup[1], first, last, totals);
+        });
+        const std::chrono::duration<double> elapsed = clock_type::now() - begin;
+        std::printf("%5zux%-3zu %9zu %8.1f %8.1f %9zu %10.0f %12.0f\n", setup[0], setup[1], setup[2],
+                    100.0 * totals.wins / setup[2], 100.0 * totals.cleanWins / setup[2], totals.guesses.load(),
+                    setup[2] / elapsed.count(), totals.decisions / elapsed.count());
+    }
+
+    // Boards that need no guess, from expert size up
+    std::printf("\n%8s %7s %12s %10s %10s\n", "board", "boards", "candidates", "mean ms", "max ms");
+    Generator generator;
+    const size_t GENERATED[][2] = { { 30, 16 }, { 50, 50 }, { 100, 100 } };
+    const size_t BOARDS = 10;
+    for (const auto& size : GENERATED) {
+        size_t candidates = 0;
+        double total = 0;
+        double worst = 0;
+        for (size_t seed = 0; seed < BOARDS; ++seed) {
+            const clock_type::time_point begin = clock_type::now();
+            generator.generate(size[0], size[1], Engine::Coordinate(size[1] / 2, size[0] / 2), seed);
+            const double elapsed = std::chrono::duration<double, std::milli>(clock_type::now() - begin).count();
+            candidates += generator.getCandidates();
+            total += elapsed;
+            worst = std::max(worst, elapsed);
+        }
+        std::printf("%5zux%-3zu %7zu %12.1f %10.1f %10.1f\n", size[0], size[1], BOARDS,
+                    double(candidates) / BOARDS, total / BOARDS, worst);
+    }
+
+    // Mine probabilities after every click of solver-played games, from scratch and with the
+    // components the click left alone taken from the cache; a stuck solver opens the safest cell
+    std::printf("\n%8s %9s %10s %10s %9s %8s\n", "board", "positions", "fresh ms", "cached ms", "reused %", "exact %");
+    const size_t HEATMAP_GAMES[][3] = { { 30, 16, 20 }, { 100, 100, 3 } };
+    for (const auto& setup : HEATMAP_GAMES) {
+        const std::atomic<bool> cancel(false);
+        size_t positions = 0;
+        size_t enumerated = 0;
+        size_t cached = 0;
+        size_t exact = 0;
+        double fresh = 0;
+        double incremental = 0;
+        std::vector<int8_t> view;
+        std::vector<float> probabilities;
+        for (size_t game = 0; game < setup[2]; ++game) {
+            Engine engine(setup[0], setup[1], game);
+            Solver solver(engine);
+            Probability cache;
+            const Engine::board_type& board = engine.getBoard();
+            Engine::Coordinate coord(board.getCols() / 2, board.getRows() / 2);
+            while (true) {
+                engine.open(coord);
+                solver.opened(engine, coord);
+                if (engine.isGameOver()) { break; }
+
+                view.resize(board.size());
+                for (size_t i = 0; i < board.size(); ++i) {
+                    view[i] = board[i].isRevealed() ? int8_t(board[i].getCount()) : Probability::CLOSED;
+                }
+                clock_type::time_point begin = clock_type::now();
+                Probability().compute(view, board.getRows(), board.getCols(), engine.getMinesCount(), cancel, probabilities);
+                fresh += std::chrono::duration<double, std::milli>(clock_type::now() - begin).count();
+                begin = clock_type::now();
+                cache.compute(view, board.getRows(), board.getCols(), engine.getMinesCount(), cancel, probabilities);
+                incremental += std::chrono::duration<double, std::milli>(clock_type::now() - begin).count();
+                enumerated += cache.getEnumerated();
+                cached += cache.getCached();
+                exact += cache.getUnsolved() == 0;
+                ++positions;
+
+                if (solver.solve(engine) && solver.nextSafe(coord)) { continue; }
+                size_t safest = 0;
+                for (size_t i = 1; i < board.size(); ++i) {
+                    if (probabilities[i] >= 0 && (probabilities[safest] < 0 || probabilities[i] < probabilities[safest])) { safest = i; }
+                }
+                coord = board.coordinateOf(safest);
+            }
+        }
+        std::printf("%5zux%-3zu %9zu %10.3f %10.3f %9.1f %8.1f\n", setup[0], setup[1], positions, fresh / positions,
+                    incremental / positions, 100.0 * cached / std::max<size_t>(cached + enumerated, 1), 100.0 * exact / positions);
+    }
+
+    // The endless board: cost follows the explored square, and chunks evicted on the way are
+    // rebuilt exactly, as the comparison with an engine that never evicts checks
+    std::printf("\n%8s %10s %8s %9s %8s %10s %12s\n", "explored", "opened", "built", "resident", "saved", "ms", "ns/opened");
+    for (const size_t side : { 256, 1024, 2048 }) {
+        InfiniteEngine engine(1, 256);
+        const clock_type::time_point begin = clock_type::now();
+        explore(engine, side);
+        const std::chrono::duration<double, std::milli> elapsed = clock_type::now() - begin;
+
+        InfiniteEngine reference(1, 0);
+        explore(reference, side);
+        bool same = engine.getOpened() == reference.getOpened();
+        const InfiniteEngine::Coordinate origin = InfiniteEngine::getOrigin();
+        for (size_t y = origin.y - side / 2 - 1; y <= origin.y + side / 2 && same; ++y) {
+            for (size_t x = origin.x - side / 2 - 1; x <= origin.x + side / 2 && same; ++x) {
+                const Engine::Cell left = engine.getCell({ x, y });
+                const Engine::Cell right = reference.getCell({ x, y });
+                same = left.getElement() == right.getElement() && left.isRevealed() == right.isRevealed();
+            }
+        }
+
+        std::printf("%4zux%-4zu %10zu %8zu %9zu %8zu %10.1f %12.1f%s\n", side, side, engine.getOpened(), engine.getChunksBuilt(),
+                    engine.getChunksResident(), engine.getChunksSaved(), elapsed.count(), elapsed.count() * 1e6 / engine.getOpened(),
+                    same ? "" : "  MISMATCH");
+    }
+
+    // First click on huge boards: laying the mines and numbering every cell
+    std::printf("\n%12s %10s %14s\n", "board", "mines", "first click ms");
+    for (const size_t side : { 1000, 4000, 10000 }) {
+        Engine engine(side, side, 1);
+        const clock_type::time_point start = clock_type::now();
+        engine.open(Engine::Coordinate(side / 2, side / 2));
+        const std::chrono::duration<double, std::milli> elapsed = clock_type::now() - start;
+        std::printf("%6zux%-5zu %10zu %14.1f\n", side, side, engine.getMinesCount(), elapsed.count());
+    }
+
+    return 0;
+}
@@ -0,0 +1,166 @@
+#include "headers/Engine.hpp"
+#include "headers/Solver.hpp"
+#include "headers/Probability.hpp"
+#include <gtest/gtest.h>
+#include <atomic>
+#include <string>
+#include <vector>
+
+namespace
+{
+    typedef SamHovhannisyan::MinesweeperGame::Engine Engine;
+    typedef SamHovhannisyan::MinesweeperGame::Solver Solver;
+    typedef SamHovhannisyan::MinesweeperGame::Probability Probability;
+    typedef Engine::Coordinate Coordinate;
+
+    /// Start engine from a picture of the board, one string per row: '*' is a mine, 'o' an
+    /// open cell and '.' a closed safe one
+    void
+    setUp(Engine& engine, const std::vector<std::string>& rows)
+    {
+        const size_t height = rows.size();
+        const size_t width = rows.front().size();
+        Engine::board_type board(height, width);
+        uint64_t mines = 0;
+        for (size_t y = 0; y < height; ++y) {
+            for (size_t x = 0; x < width; ++x) {
+                Engine::Cell& cell = board(Coordinate(x, y));
+                cell.setMine(rows[y][x] == '*');
+                cell.setRevealed(rows[y][x] == 'o');
+                mines += cell.isMine();
+
+                uint8_t count = 0;
+                for (size_t ny = y == 0 ? 0 : y - 1; ny <= y + 1 && ny < height; ++ny) {
+                    for (size_t nx = x == 0 ? 0 : x - 1; nx <= x + 1 && nx < width; ++nx) {
+                        count += (nx != x || ny != y) && rows[ny][nx] == '*';
+                    }
+                }
+                cell.setCount(count);
+            }
+        }
+
+        SamHovhannisyan::Snapshot::StateWriter state;
+        state.put(false);
+        state.put(false);
+        state.put<uint64_t>(mines);
+        state.put<uint64_t>(0);
+        const std::string path = "builds/minesweeper_test.bin";
+        SamHovhannisyan::Snapshot::save(path, Engine::SNAPSHOT_KIND, board, state);
+        engine.load(path);
+    }
+
+    /// Everything the solver deduces, as a picture: 's' safe, 'm' mine, '?' unknown, 'o' open
+    std::vector<std::string>
+    deduce(const Engine& engine)
+    {
+        const Engine::board_type& board = engine.getBoard();
+        Solver solver(engine);
+        for (size_t y = 0; y < board.getRows(); ++y) {
+            for (size_t x = 0; x < board.getCols(); ++x) {
+                if (board(Coordinate(x, y)).isRevealed()) { solver.opened(engine, Coordinate(x, y)); }
+            }
+        }
+        // Take the safe cells without opening them, so only the numbers on the board count
+        Coordinate coord;
+        while (solver.solve(engine)) {
+            while (solver.nextSafe(coord)) {}
+        }
+
+        std::vector<std::string> result(board.getRows(), std::string(board.getCols(), '?'));
+        for (size_t y = 0; y < board.getRows(); ++y) {
+            for (size_t x = 0; x < board.getCols(); ++x) {
+                result[y][x] = "?smo"[solver.getKnowledge(Coordinate(x, y))];
+            }
+        }
+        return result;
+    }
+}
+
+TEST(SolverTest, OneTwoOne)
+{
+    // The open row reads 1 1 2 1 1 against the wall of closed cells above it
+    Engine engine;
+    setUp(engine, { ".*.*.",
+                    "ooooo" });
+    const std::vector<std::string> expected = { "smsms",
+                                                "ooooo" };
+    EXPECT_EQ(deduce(engine), expected);
+}
+
+TEST(SolverTest, SubsetDeduction)
+{
+    // 1 1 1 1: no number decides its cells alone, but each end 1 is a subset of its neighbour
+    Engine engine;
+    setUp(engine, { "*..*",
+                    "oooo" });
+    const std::vector<std::string> expected = { "mssm",
+                                                "oooo" };
+    EXPECT_EQ(deduce(engine), expected);
+}
+
+TEST(SolverTest, UndecidableStaysUnknown)
+{
+    // A lone 1 with three closed neighbours and no other clue
+    Engine engine;
+    setUp(engine, { "o.",
+                    ".*" });
+    const std::vector<std::string> expected = { "o?",
+                                                "??" };
+    EXPECT_EQ(deduce(engine), expected);
+}
+
+TEST(ProbabilityTest, WeighsConfigurationsByMineCount)
+{
+    // Two 1s share (1, 0) and (1, 1). Either one mine sits there, leaving the other mine to
+    // the 3 cells no number touches (2 ways x 3), or (0, 1) and (2, 1) are both mines (1 way)
+    const int8_t C = Probability::CLOSED;
+    const std::vector<int8_t> view = { 1, C, 1,
+                                       C, C, C,
+                                       C, C, C };
+    Probability probability;
+    std::atomic<bool> cancel(false);
+    std::vector<float> out;
+    ASSERT_TRUE(probability.compute(view, 3, 3, 2, cancel, out));
+    ASSERT_EQ(out.size(), 9);
+
+    EXPECT_EQ(out[0], Probability::NONE);
+    EXPECT_EQ(out[2], Probability::NONE);
+    EXPECT_NEAR(out[1], 3.0 / 7, 1e-6);
+    EXPECT_NEAR(out[4], 3.0 / 7, 1e-6);
+    EXPECT_NEAR(out[3], 1.0 / 7, 1e-6);
+    EXPECT_NEAR(out[5], 1.0 / 7, 1e-6);
+    for (size_t cell = 6; cell < 9; ++cell) { EXPECT_NEAR(out[cell], 2.0 / 7, 1e-6); }
+    EXPECT_EQ(probability.getEnumerated(), 1);
+
+    // The same frontier again comes from the cache
+    ASSERT_TRUE(probability.compute(view, 3, 3, 2, cancel, out));
+    EXPECT_EQ(probability.getCached(), 1);
+    EXPECT_NEAR(out[1], 3.0 / 7, 1e-6);
+
+    // A raised cancel flag stops the computation
+    cancel = true;
+    EXPECT_FALSE(probability.compute(view, 3, 3, 2, cancel, out));
+}
+
+TEST(ProbabilityTest, SettledCells)
+{
+    // (0, 0) is the only closed neighbour of the 1 at (1, 0), so it is certain
+    const int8_t C = Probability::CLOSED;
+    const std::vector<int8_t> view = { C, 1, 0,
+                                       1, 1, 0,
+                                       0, 0, 0 };
+    Probability probability;
+    std::atomic<bool> cancel(false);
+    std::vector<float> out;
+    ASSERT_TRUE(probability.compute(view, 3, 3, 1, cancel, out));
+    EXPECT_NEAR(out[0], 1.0, 1e-6);
+    for (size_t cell = 1; cell < 9; ++cell) { EXPECT_EQ(out[cell], Probability::NONE); }
+    EXPECT_EQ(probability.getEnumerated(), 0);
+}
+
+int
+main(int argc, char **argv)
+{
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
@@ -0,0 +1,205 @@
+#include "../headers/Engine.hpp"
+#include "../headers/Flood.hpp"
+
+#include <algorithm>
+
+namespace SamHovhannisyan::MinesweeperGame
+{
+    namespace
+    {
+        /// No mine is laid within this distance of the first click
+        const size_t SAFE_RADIUS = 2;
+        /// Boards from this many cells flood in parallel bands and are redrawn as a whole
+        const size_t PARALLEL_FLOOD_CELLS = size_t(1) << 22;
+    }
+
+    static_assert(sizeof(Engine::Cell) == 1, "Minesweeper cells are packed into one byte");
+
+    const uint32_t Engine::SNAPSHOT_KIND = Snapshot::kindOf("MINE");
+
+    Engine::Engine(const size_t width, const size_t height, const uint32_t seed)
+        : board_(width, height)
+        , random_(seed)
+    {
+        if (width == 0 || height == 0) { throw std::invalid_argument("Board dimensions cannot be zero"); }
+        reset();
+    }
+
+    void
+    Engine::reset()
+    {
+        board_.fill(Cell());
+        first_click_ = true;
+        game_over_ = false;
+        mines_count_ = 0;
+        flags_placed_ = 0;
+        closed_safe_ = board_.size();
+        mines_.clear();
+    }
+
+    void
+    Engine::open(const Coordinate& coord)
+    {
+        if (game_over_ || coord.x >= board_.getCols() || coord.y >= board_.getRows()) { return; }
+
+        // The first click lays the mines around a safe zone
+        if (first_click_) { generateMines(coord); }
+        openCell(coord);
+
+        if (isWin()) { game_over_ = true; }
+    }
+
+    void
+    Engine::toggleFlag(const Coordinate& coord)
+    {
+        if (game_over_ || first_click_) { return; }
+        if (coord.x >= board_.getCols() || coord.y >= board_.getRows()) { return; }
+        placeRemoveFlag(coord);
+    }
+
+    void 
+    Engine::generateMines(const Coordinate& coord)
+    {
+        first_click_ = false;
+
+        // The safe zone is the square of radius 2 around the click, clipped to the board
+        const size_t rows = board_.getRows();
+        const size_t cols = board_.getCols();
+        const size_t left = coord.x < SAFE_RADIUS ? 0 : coord.x - SAFE_RADIUS;
+        const size_t top = coord.y < SAFE_RADIUS ? 0 : coord.y - SAFE_RADIUS;
+        const size_t width = std::min(coord.x + SAFE_RADIUS + 1, cols) - left;
+        const size_t height = std::min(coord.y + SAFE_RADIUS + 1, rows) - top;
+        const size_t area = rows * cols;
+        const size_t candidates = area - width * height;
+
+        mines_count_ = std::min(std::max<size_t>(area * 17 / 100, 1), candidates);
+
+        // Candidate number i is the i-th cell in row-major order that is outside the safe zone
+        const auto cellOf = [=](size_t candidate) {
+            if (candidate < top * cols) { return candidate; }
+            candidate -= top * cols;
+            const size_t band = height * (cols - width);
+            if (candidate >= band) { return (top + height) * cols + candidate - band; }
+            const size_t y = top + candidate / (cols - width);
+            const size_t x = candidate % (cols - width);
+            return y * cols + (x < left ? x : x + width);
+        };
+
+        // Floyd's sampling: mines_count_ distinct candidates in O(mines) draws, with the
+        // bit board that is needed for the neighbour counts anyway as the membership set
+        BitBoard::BitBoard mines(rows, cols);
+        mines_.clear();
+        mines_.reserve(mines_count_);
+        for (size_t j = candidates - mines_count_; j < candidates; ++j) {
+            const size_t drawn = cellOf(std::uniform_int_distribution<size_t>(0, j)(random_));
+            const Coordinate cell = board_.coordinateOf(drawn);
+            const size_t mine = mines(cell) ? cellOf(j) : drawn;
+            mines.set(board_.coordinateOf(mine));
+            mines_.push_back(mine);
+        }
+        closed_safe_ = area - mines_count_;
+        placeBombs(mines);
+    }
+
+    void 
+    Engine::placeBombs(const BitBoard::BitBoard& mines)
+    {
+        // A cell is its neighbour count in the low bits, so the word-parallel pass writes the
+        // numbers straight into the board and only the mines need a second touch
+        static_assert(Cell::COUNT_MASK == 0x0F, "the neighbour count is the low bits of a cell");
+        mines.neighbourCounts(reinterpret_cast<uint8_t*>(board_.data()));
+        for (const size_t mine : mines_) { board_[mine].setMine(true); }
+    }
+
+    void 
+    Engine::openCell(const Coordinate& coord)
+    {
+        const Cell& current = board_.getBoard()(coord);
+        if (current.isFlagged() || current.isRevealed()) { return; }
+        Cell& cell = board_(coord);
+        cell.setRevealed(true);
+        
+        if (cell.isMine()) {
+            game_over_ = true;
+            revealAllMines();
+            return;
+        }
+
+        --closed_safe_;
+        if (cell.getCount() == 0) { openEmptysFrom(coord); }
+    }
+
+    void 
+    Engine::openEmptysFrom(const Coordinate& coord)
+    {
+        if (board_.size() < PARALLEL_FLOOD_CELLS) {
+            closed_safe_ -= Flood::reveal(board_, coord);
+            return;
+        }
+
+        if (!pool_) { pool_ = std::make_shared<ThreadPool::ThreadPool>(); }
+        closed_safe_ -= Flood::revealBanded(board_, coord, *pool_);
+    }
+
+    void
+    Engine::placeRemoveFlag(const Coordinate& coord)
+    {
+        if (board_.getBoard()(coord).isRevealed()) { return; }
+        Cell& cell = board_(coord);
+        cell.setFlagged(!cell.isFlagged());
+        if (cell.isFlagged()) { ++flags_placed_; }
+        else { --flags_placed_; }
+    }
+
+    void 
+    Engine::revealAllMines() 
+    {
+        for (const size_t mine : mines_) { board_[mine].setRevealed(true); }
+    }
+
+    void
+    Engine::countCells()
+    {
+        closed_safe_ = 0;
+        mines_.clear();
+        for (size_t index = 0; index < board_.size(); ++index) {
+            const Cell& cell = board_.getBoard()[index];
+            if (cell.isMine()) { mines_.push_back(index); }
+            else if (!cell.isRevealed()) { ++closed_safe_; }
+        }
+    }
+
+    void
+    Engine::save(const std::string& path) const
+    {
+        Snapshot::save(path, SNAPSHOT_KIND, board_, saveState());
+    }
+
+    void
+    Engine::load(const std::string& path)
+    {
+        const Snapshot::MappedBoard<cell_type> snapshot(path, SNAPSHOT_KIND);
+        const auto view = snapshot.getBoard();
+        Snapshot::StateReader state = snapshot.getState();
+
+        board_.resize(view.getRows(), view.getCols());
+        Snapshot::restore(view, board_);
+        first_click_ = state.get<bool>();
+        game_over_ = state.get<bool>();
+        mines_count_ = state.get<uint64_t>();
+        flags_placed_ = state.get<uint64_t>();
+        countCells();
+    }
+
+    Snapshot::StateWriter
+    Engine::saveState() const
+    {
+        // Flags live in the cells, so the board bytes already hold them
+        Snapshot::StateWriter state;
+        state.put(first_click_);
+        state.put(game_over_);
+        state.put<uint64_t>(mines_count_);
+        state.put<uint64_t>(flags_placed_);
+        return state;
+    }
+}
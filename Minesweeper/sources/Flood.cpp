@@ -0,0 +1,173 @@
+#include "headers/Flood.hpp"
+
+#include <algorithm>
+#include <vector>
+
+namespace SamHovhannisyan::MinesweeperGame::Flood
+{
+    namespace
+    {
+        typedef Engine::Cell Cell;
+
+        /// Bands per thread, so that a region crossing only part of the board still spreads
+        const size_t BANDS_PER_THREAD = 2;
+
+        /// @brief The cells first .. last of row y
+        struct Span
+        {
+            size_t y;
+            size_t first;
+            size_t last;
+        };
+
+        /// @brief Rows top .. bottom - 1 of the board and the fill work inside them
+        class Band
+        {
+        public:
+            /// @param board Written through, for dirty tracking; nullptr writes to cells directly
+            Band(Engine::board_type* board, const Cell* cells, Cell* writable, const size_t rows,
+                 const size_t cols, const size_t top, const size_t bottom)
+                : opened(0)
+                , board_(board)
+                , cells_(cells)
+                , writable_(writable)
+                , rows_(rows)
+                , cols_(cols)
+                , top_(top)
+                , bottom_(bottom)
+            {
+            }
+
+            /// @brief Grow the run through the open empty cell (x, y) and queue it
+            void grow(const size_t y, const size_t x)
+            {
+                const size_t row = y * cols_;
+                size_t first = x;
+                size_t last = x;
+                while (first > 0 && isClosedEmpty(row + first - 1)) { open(row + --first); }
+                while (last + 1 < cols_ && isClosedEmpty(row + last + 1)) { open(row + ++last); }
+                runs_.push_back({ y, first, last });
+            }
+
+            /// @brief Scan the spans handed over by the neighbours, then expand every run
+            void flood()
+            {
+                for (const Span& span : incoming) { scan(span); }
+                incoming.clear();
+
+                while (!runs_.empty()) {
+                    const Span run = runs_.back();
+                    runs_.pop_back();
+
+                    const size_t first = run.first == 0 ? 0 : run.first - 1;
+                    const size_t last = std::min(run.last + 1, cols_ - 1);
+                    if (run.y > 0) { around({ run.y - 1, first, last }); }
+                    around({ run.y, first, last });
+                    if (run.y + 1 < rows_) { around({ run.y + 1, first, last }); }
+                }
+            }
+
+        public:
+            /// @brief Spans to scan in this band, and the ones for the bands above and below
+            std::vector<Span> incoming;
+            std::vector<Span> up;
+            std::vector<Span> down;
+            size_t opened;
+
+        private:
+            /// @brief Flagged cells are left closed, so they stop the fill like InfiniteEngine's
+            bool isClosed(const size_t index) const
+            {
+                return !cells_[index].isRevealed() && !cells_[index].isFlagged();
+            }
+
+            bool isClosedEmpty(const size_t index) const
+            {
+                return isClosed(index) && cells_[index].getElement() == Engine::EMPTY;
+            }
+
+            const Cell& open(const size_t index)
+            {
+                Cell& cell = writable_ != nullptr ? writable_[index] : (*board_)[index];
+                cell.setRevealed(true);
+                ++opened;
+                return cell;
+            }
+
+            void around(const Span& span)
+            {
+                if (span.y < top_) { up.push_back(span); }
+                else if (span.y >= bottom_) { down.push_back(span); }
+                else { scan(span); }
+            }
+
+            /// @brief Open the closed cells of the span; an empty one starts a new run
+            void scan(const Span& span)
+            {
+                const size_t row = span.y * cols_;
+                for (size_t x = span.first; x <= span.last; ++x) {
+                    if (!isClosed(row + x)) { continue; }
+                    if (open(row + x).getElement() != Engine::EMPTY) { continue; }
+                    grow(span.y, x);
+                    x = runs_.back().last;
+                }
+            }
+
+        private:
+            Engine::board_type* board_;
+            const Cell* cells_;
+            Cell* writable_;
+            size_t rows_;
+            size_t cols_;
+            size_t top_;
+            size_t bottom_;
+            /// @brief Runs opened but not expanded yet
+            std::vector<Span> runs_;
+        };
+    }
+
+    size_t
+    reveal(Engine::board_type& board, const Coordinate::Coordinate& start)
+    {
+        const Engine::board_type& view = board;
+        Band band(&board, view.data(), nullptr, board.getRows(), board.getCols(), 0, board.getRows());
+        band.grow(start.y, start.x);
+        band.flood();
+        return band.opened;
+    }
+
+    size_t
+    revealBanded(Engine::board_type& board, const Coordinate::Coordinate& start, ThreadPool::ThreadPool& pool)
+    {
+        const size_t rows = board.getRows();
+        const size_t height = (rows + pool.size() * BANDS_PER_THREAD - 1) / (pool.size() * BANDS_PER_THREAD);
+        Cell* cells = board.data();
+
+        std::vector<Band> bands;
+        for (size_t top = 0; top < rows; top += height) {
+            bands.emplace_back(nullptr, cells, cells, rows, board.getCols(), top, std::min(top + height, rows));
+        }
+        bands[start.y / height].grow(start.y, start.x);
+
+        bool pending = true;
+        while (pending) {
+            pool.parallelFor(bands.size(), [&bands](const size_t begin, const size_t end) {
+                for (size_t band = begin; band < end; ++band) { bands[band].flood(); }
+            });
+
+            // Hand the edge rows over between rounds, while no band is running
+            pending = false;
+            for (size_t band = 0; band < bands.size(); ++band) {
+                if (band > 0) { bands[band - 1].incoming.insert(bands[band - 1].incoming.end(), bands[band].up.begin(), bands[band].up.end()); }
+                if (band + 1 < bands.size()) { bands[band + 1].incoming.insert(bands[band + 1].incoming.end(), bands[band].down.begin(), bands[band].down.end()); }
+                bands[band].up.clear();
+                bands[band].down.clear();
+            }
+            for (const Band& band : bands) { pending = pending || !band.incoming.empty(); }
+        }
+
+        size_t opened = 0;
+        for (const Band& band : bands) { opened += band.opened; }
+        return opened;
+    }
+}
@@ -1,10 +1,7 @@
 #include "../headers/Game.hpp"
-#include <cstdlib>
-#include <iomanip>
-#include <numeric>
 #include <ncurses.h>
-#include <queue>
-#include <unordered_set>
+#include <algorithm>
+#include <random>
 
 namespace SamHovhannisyan::MinesweeperGame
 {
@@ -12,15 +9,27 @@ namespace SamHovhannisyan::MinesweeperGame
     size_t mouseY = 0;
     bool mouseHover = false;
 
-    Minesweeper::Minesweeper(const size_t width, const size_t height)
-        : board_(width, height)
-        , first_click_(true)
-        , game_over_(false)
-        , mines_count_(0)
-        , flags_placed_(0)
+    namespace
     {
-        if (width == 0 || height == 0) { throw std::invalid_argument("Board dimensions cannot be zero"); }
+        const int BOARD_START_X = 3;
+        const int BOARD_START_Y = 3;
+        const int CELL_WIDTH = 3;
+        /// The blank line and the two lines of instructions under the board
+        const int INSTRUCTION_ROWS = 3;
+        /// Cells kept between the keyboard cursor and the edge of a scrolled window
+        const size_t CURSOR_MARGIN = 2;
+        /// How often the input loop wakes up to look for new probabilities
+        const int HEATMAP_POLL_MS = 100;
+    }
 
+    Minesweeper::Minesweeper(const size_t width, const size_t height)
+        : engine_(width, height)
+        , quit_(false)
+        , hoverDrawn_(false)
+        , heatmapChanged_(false)
+        , viewport_(CELL_WIDTH)
+        , redraw_(true)
+    {
         // Initialize ncurses
         initscr();
         cbreak();
@@ -29,212 +38,132 @@ namespace SamHovhannisyan::MinesweeperGame
         mousemask(ALL_MOUSE_EVENTS, NULL);
         curs_set(0); // Hide cursor
 
-        for (size_t y = 0; y < board_.getRows(); ++y) 
-        {
-            for (size_t x = 0; x < board_.getCols(); ++x) 
-            {
-                board_({x, y}) = {BoardElements::EMPTY, false};
-            }
-        }
+        engine_.setDirtyTracking(true);
     }
 
     void 
-    Minesweeper::drawBoard() const
+    Minesweeper::drawBoard()
     {
-        clear();
-        
-        // Draw header
-        attron(A_BOLD);
-        printw("Minesweeper - Mines: %zu | Flags: %zu\n\n", mines_count_, flags_placed_);
-        attroff(A_BOLD);
-
-        // Draw column numbers
-        printw("   ");
-        for (size_t x = 0; x < board_.getCols(); ++x) {
-            printw("%2zu ", x + 1);
-        }
-        printw("\n");
+        const Engine::board_type& board = engine_.getBoard();
+        const Coordinate previous = hovered_;
+        const bool previousDrawn = hoverDrawn_;
+        hovered_ = Coordinate(mouseX, mouseY);
+        hoverDrawn_ = mouseHover;
+        if (heatmap_ && heatmap_->poll(probabilities_)) { heatmapChanged_ = true; }
 
-        for (size_t y = 0; y < board_.getRows(); ++y) 
+        // Only the cells inside the viewport are ever drawn
+        const bool full = redraw_ || board.isAllDirty();
+        if (full) { layout(); }
+        const Coordinate& origin = viewport_.getOrigin();
+        const size_t endX = origin.x + viewport_.getCols();
+        const size_t endY = origin.y + viewport_.getRows();
+        if (full) 
         {
-            // Draw row number
-            attron(A_BOLD);
-            printw("%2zu ", y + 1);
-            attroff(A_BOLD);
+            clear();
 
-            for (size_t x = 0; x < board_.getCols(); ++x) 
-            {
-                const auto current = board_({x, y});
-                
-                // Highlight cell if mouse is over it
-                if (mouseHover && mouseX == x && mouseY == y) {
-                    attron(A_REVERSE);
-                }
-
-                if (getFlag({x, y}) != flags_.end()) 
-                {
-                    printw("[F]");
-                    if (mouseX == x && mouseY == y) { attroff(A_REVERSE); }
-                    continue;
-                }
-
-                switch (current.first)
-                {
-                case EMPTY:  printw(current.second ? "   " : "[ ]"); break;
-                case ONE:    printw(current.second ? "[1]" : "[ ]"); break;
-                case TWO:    printw(current.second ? "[2]" : "[ ]"); break;
-                case THREE:  printw(current.second ? "[3]" : "[ ]"); break;
-                case FOUR:   printw(current.second ? "[4]" : "[ ]"); break;
-                case FIVE:   printw(current.second ? "[5]" : "[ ]"); break;
-                case SIX:    printw(current.second ? "[6]" : "[ ]"); break;
-                case SEVEN:  printw(current.second ? "[7]" : "[ ]"); break;
-                case EIGHT:  printw(current.second ? "[8]" : "[ ]"); break;
-                case MINE:   printw(current.second ? "[*]" : "[ ]"); break;
-                default:     printw("[?]"); break;
-                }
-
-                if (mouseX == x && mouseY == y) {
-                    attroff(A_REVERSE);
-                }
+            // Draw column numbers
+            for (size_t x = origin.x; x < endX; ++x) {
+                mvprintw(2, viewport_.screenX(x), x < 99 ? "%2zu " : "%3zu", x + 1);
             }
-            printw("\n");
-        }
-        
-        // Draw instructions
-        printw("\nLeft-click: Open cell | Right-click: Place flag\n");
-        printw("Press 'q' to quit\n");
-        refresh();
-    }
-    
-    void 
-    Minesweeper::generateMines(const Coordinate& coord)
-    {
-        if (coord == Coordinate(board_.getCols(), board_.getRows())) 
-        { return; }
-        first_click_ = false;
-
-        const size_t area = board_.getCols() * board_.getRows();
-        mines_count_ = area * 17 / 100; 
-        if (mines_count_ < 1) { mines_count_ = 1; }  
-        flags_.reserve(mines_count_);
-        
-        std::vector<size_t> positions(area);
-        std::iota(positions.begin(), positions.end(), 0);
 
-        std::unordered_set<size_t> exclude_positions;
-    
-        // Add the clicked position
-        exclude_positions.insert(coord.y * board_.getCols() + coord.x);
+            for (size_t y = origin.y; y < endY; ++y) 
+            {
+                // Draw row number
+                attron(A_BOLD);
+                mvprintw(viewport_.screenY(y), 0, y < 99 ? "%2zu " : "%3zu", y + 1);
+                attroff(A_BOLD);
 
-        // Add all 8 neighboring positions
-        for (int dy = -2; dy <= 2; ++dy) {
-            for (int dx = -2; dx <= 2; ++dx) {
-                if (dx == 0 && dy == 0)  
-                { continue; }
-                
-                int ny = coord.y + dy;
-                int nx = coord.x + dx;
-                
-                if (ny >= 0 && ny < static_cast<int>(board_.getRows()) && 
-                    nx >= 0 && nx < static_cast<int>(board_.getCols())) 
-                {
-                    exclude_positions.insert(ny * board_.getCols() + nx);
-                }
+                for (size_t x = origin.x; x < endX; ++x) { drawCell({x, y}); }
             }
+            
+            // Draw instructions
+            mvprintw(BOARD_START_Y + viewport_.getRows() + 1, 0, "Left-click: Open cell | Right-click: Place flag\n");
+            printw("Arrows: Move | Enter: Open | 'f': Flag | 'h': Mine odds | 'q': Quit\n");
+            redraw_ = false;
         }
-
-        // Remove excluded positions from the possible mine positions
-        positions.erase(
-            std::remove_if(positions.begin(), positions.end(),
-                [&exclude_positions](size_t pos) {
-                    return exclude_positions.find(pos) != exclude_positions.end();
-                }),
-            positions.end()
-        ); 
-
-        std::shuffle(positions.begin(), positions.end(), std::mt19937(std::random_device()()));
-        
-        for (size_t i = 0; i < mines_count_; ++i) { placeBomb(positions[i]); }
-    }
-
-    void 
-    Minesweeper::placeBomb(const size_t pos)
-    {
-        const size_t x = pos % board_.getCols();
-        const size_t y = pos / board_.getCols();
-        board_({x, y}) = {BoardElements::MINE, false};
-        
-        for (int dy = -1; dy <= 1; ++dy) 
+        else 
         {
-            for (int dx = -1; dx <= 1; ++dx) 
-            {
-                if (dx == 0 && dy == 0) continue;
-                
-                const size_t nx = x + dx;
-                const size_t ny = y + dy;
-                
-                if (nx < board_.getCols() && ny < board_.getRows()) 
-                {
-                    auto& cell = board_({nx, ny});
-                    if (cell.first != BoardElements::MINE) 
-                    {
-                        cell.first = BoardElements{int(cell.first) + 1};
+            for (const size_t index : board.getDirty()) { 
+                const Coordinate coord = board.coordinateOf(index);
+                if (viewport_.isVisible(coord)) { drawCell(coord); }
+            }
+            if (heatmapChanged_) {
+                for (size_t y = origin.y; y < endY; ++y) {
+                    for (size_t x = origin.x; x < endX; ++x) {
+                        if (!board({x, y}).isRevealed()) { drawCell({x, y}); }
                     }
                 }
             }
+
+            // Repaint the hover highlight only where it moved
+            if (previousDrawn != hoverDrawn_ || previous != hovered_) {
+                if (previousDrawn && viewport_.isVisible(previous)) { drawCell(previous); }
+                if (hoverDrawn_ && viewport_.isVisible(hovered_))   { drawCell(hovered_); }
+            }
         }
+        engine_.clearDirty();
+        heatmapChanged_ = false;
+        
+        // Draw header
+        attron(A_BOLD);
+        mvprintw(0, 0, "Minesweeper - Mines: %zu | Flags: %zu", engine_.getMinesCount(), engine_.getFlagsPlaced());
+        attroff(A_BOLD);
+        clrtoeol();
+        refresh();
     }
 
-    void 
-    Minesweeper::openCell(const Coordinate& coord)
+    void
+    Minesweeper::layout()
     {
-        auto& cell = board_(coord);
-        if (getFlag(coord) != flags_.end()) { return; }
-        
-        cell.second = true;
-        
-        if (cell.first == BoardElements::MINE) {
-            game_over_ = true;
-            revealAllMines();
-        }
-        else if (cell.first == BoardElements::EMPTY) {
-            openEmptysFrom(coord);
-        }
+        const Engine::board_type& board = engine_.getBoard();
+        viewport_.setBoard(board.getRows(), board.getCols());
+        viewport_.setScreen(BOARD_START_Y, BOARD_START_X, LINES - BOARD_START_Y - INSTRUCTION_ROWS, COLS - BOARD_START_X);
     }
 
-    void 
-    Minesweeper::openEmptysFrom(const Coordinate& coord)
+    void
+    Minesweeper::drawCell(const Coordinate& coord) const
     {
-        std::queue<Coordinate> to_open;
-        to_open.push(coord);
+        const Engine::cell_type current = engine_.getBoard()(coord);
+        const bool highlighted = hoverDrawn_ && hovered_ == coord;
         
-        while (!to_open.empty()) {
-            const auto current = to_open.front();
-            to_open.pop();
-            
-            for (int dy = -1; dy <= 1; ++dy) {
-                for (int dx = -1; dx <= 1; ++dx) {
-                    if (dx == 0 && dy == 0) 
-                    { continue; }
-                    
-                    const size_t nx = current.x + dx;
-                    const size_t ny = current.y + dy;
-                    
-                    if (nx >= board_.getCols() || ny >= board_.getRows()) 
-                    { continue; }
-                    
-                    auto& neighbor = board_({nx, ny});
-                    if (neighbor.second) { continue; }
-                    
-                    neighbor.second = true;
-                    if (neighbor.first == BoardElements::EMPTY) {
-                        to_open.push({nx, ny});
-                    }
-                }
+        // Highlight cell if mouse is over it
+        if (highlighted) { attron(A_REVERSE); }
+        move(viewport_.screenY(coord.y), viewport_.screenX(coord.x));
+
+        const size_t index = coord.y * engine_.getBoard().getCols() + coord.x;
+        if (current.isFlagged()) { printw("[F]"); }
+        else if (!current.isRevealed() && index < probabilities_.size() && probabilities_[index] >= 0)
+        {
+            // Percent, kept off 0 and 100 unless the cell is certain
+            const float probability = probabilities_[index];
+            const int percent = probability == 0 ? 0 : probability == 1 ? 100 : std::min(std::max(int(probability * 100 + 0.5f), 1), 99);
+            attron(A_DIM);
+            if (percent == 100) { printw("100"); }
+            else { printw("%2d%%", percent); }
+            attroff(A_DIM);
+        }
+        else 
+        {
+            const bool revealed = current.isRevealed();
+            switch (current.getElement())
+            {
+            case Engine::EMPTY:  printw(revealed ? "   " : "[ ]"); break;
+            case Engine::ONE:    printw(revealed ? "[1]" : "[ ]"); break;
+            case Engine::TWO:    printw(revealed ? "[2]" : "[ ]"); break;
+            case Engine::THREE:  printw(revealed ? "[3]" : "[ ]"); break;
+            case Engine::FOUR:   printw(revealed ? "[4]" : "[ ]"); break;
+            case Engine::FIVE:   printw(revealed ? "[5]" : "[ ]"); break;
+            case Engine::SIX:    printw(revealed ? "[6]" : "[ ]"); break;
+            case Engine::SEVEN:  printw(revealed ? "[7]" : "[ ]"); break;
+            case Engine::EIGHT:  printw(revealed ? "[8]" : "[ ]"); break;
+            case Engine::MINE:   printw(revealed ? "[*]" : "[ ]"); break;
+            default:     printw("[?]"); break;
             }
         }
-    }
 
+        if (highlighted) { attroff(A_REVERSE); }
+    }
+    
     const typename Minesweeper::Coordinate
     Minesweeper::handleInput()
     {
@@ -243,88 +172,88 @@ namespace SamHovhannisyan::MinesweeperGame
         
         switch (ch) 
         {
-        case 'q': game_over_ = true; return Coordinate(board_.getCols(), board_.getRows());                
+        case 'q': quit_ = true; break;                
+        case 'h': setHeatmap(!heatmap_); break;
+        case KEY_RESIZE: redraw_ = true; break;
+        case KEY_UP:    moveCursor(-1, 0); break;
+        case KEY_DOWN:  moveCursor(1, 0);  break;
+        case KEY_LEFT:  moveCursor(0, -1); break;
+        case KEY_RIGHT: moveCursor(0, 1);  break;
+        case ' ':
+        case '\n':
+        case KEY_ENTER:
+            if (mouseHover) { return Coordinate(mouseX, mouseY); }
+            break;
+        case 'f':
+            if (mouseHover) { engine_.toggleFlag({mouseX, mouseY}); }
+            break;
         case KEY_MOUSE:
             if (getmouse(&event) == OK) {
                 mouseHover = false;
                 
-                // Convert screen coordinates to board coordinates
-                const int boardStartX = 3;
-                const int boardStartY = 3; 
-                const int cellWidth = 3; 
-                
-                // Check if mouse is within board bounds
-                if (event.y >= boardStartY && event.x >= boardStartX) {
-                    size_t potentialX = (event.x - boardStartX) / cellWidth;
-                    size_t potentialY = event.y - boardStartY;
-                
-                    // Validate coordinates
-                    if (potentialX < board_.getCols() && 
-                        potentialY < board_.getRows()) 
-                    {
-                        mouseX = potentialX;
-                        mouseY = potentialY;
-                        mouseHover = true;
-                        
-                        if (event.bstate & BUTTON1_CLICKED) { return Coordinate(mouseX, mouseY); }
-                        else if (event.bstate & BUTTON3_CLICKED && !first_click_) {
-                            placeRemoveFlag({mouseX, mouseY});
-                        }
+                // Convert screen coordinates to board coordinates through the viewport
+                Coordinate cell;
+                if (viewport_.toBoard(event.y, event.x, cell)) {
+                    mouseX = cell.x;
+                    mouseY = cell.y;
+                    mouseHover = true;
+                    
+                    if (event.bstate & BUTTON1_CLICKED) { return Coordinate(mouseX, mouseY); }
+                    else if (event.bstate & BUTTON3_CLICKED) {
+                        engine_.toggleFlag({mouseX, mouseY});
                     }
                 }
             }
         }
 
-        return Coordinate(board_.getCols(), board_.getRows());
+        return Coordinate(engine_.getBoard().getCols(), engine_.getBoard().getRows());
     }
 
     void
-    Minesweeper::placeRemoveFlag(const Coordinate& coord)
+    Minesweeper::moveCursor(const long dy, const long dx)
     {
-        auto& cell = board_({coord.x, coord.y});
-        const auto& flag = getFlag(coord);
-        if (cell.second) { return; }
-        if (!cell.second && flag == flags_.end()) {
-            flags_.push_back(coord);
-            ++flags_placed_;
+        const Engine::board_type& board = engine_.getBoard();
+        if (mouseHover) {
+            // Step within the board, starting from the hovered cell
+            if (dx < 0 && mouseX > 0) { --mouseX; }
+            if (dx > 0 && mouseX + 1 < board.getCols()) { ++mouseX; }
+            if (dy < 0 && mouseY > 0) { --mouseY; }
+            if (dy > 0 && mouseY + 1 < board.getRows()) { ++mouseY; }
         }
-        else if (flag != flags_.end()) {
-            flags_.erase(flag);
-            --flags_placed_;
+        else {
+            const Coordinate& origin = viewport_.getOrigin();
+            mouseX = origin.x;
+            mouseY = origin.y;
+            mouseHover = true;
         }
-    }
-
-    std::vector<SamHovhannisyan::MinesweeperGame::Minesweeper::Coordinate>::const_iterator
-    Minesweeper::getFlag(const Coordinate& coord) const
-    {
-        return std::find(flags_.begin(), flags_.end(), coord);
+        if (viewport_.follow(Coordinate(mouseX, mouseY), CURSOR_MARGIN)) { redraw_ = true; }
     }
 
     void 
     Minesweeper::start()
     {
-        while (!game_over_) 
+        requestHeatmap();
+        while (!engine_.isGameOver() && !quit_) 
         {
             drawBoard();
             Coordinate coord = handleInput();
             
-            // Check for quit
-            if (coord == Coordinate(board_.getCols(), board_.getRows())) { continue; }
-            
-            if (first_click_) {
-                generateMines(coord);
-                openCell(coord);  // Open the first clicked cell
-                first_click_ = false;
-            } 
-            else { openCell(coord); }
+            // Check for quit or a click outside the board
+            if (coord == Coordinate(engine_.getBoard().getCols(), engine_.getBoard().getRows())) { continue; }
             
-            if (checkWin()) { game_over_ = true; }
+            if (generator_ && engine_.isFirstClick()) { openNoGuess(coord); }
+            else { engine_.open(coord); }
+            requestHeatmap();
+            if (!checkpoint_.empty()) { 
+                writer_.write(checkpoint_, Engine::SNAPSHOT_KIND, engine_.getBoard(), engine_.saveState()); 
+            }
         }
+        writer_.wait();
             
         // Game over screen
         
         clear();
-        if (checkWin()) { printw("Congratulations! You won!\n"); } 
+        if (engine_.isWin()) { printw("Congratulations! You won!\n"); } 
         else { printw("Game Over! You hit a mine!\n"); }
         
         printw("Press any key to exit...");
@@ -334,29 +263,71 @@ namespace SamHovhannisyan::MinesweeperGame
         endwin(); // Clean up ncurses
     }
     
-    bool 
-    Minesweeper::checkWin() const
+    void
+    Minesweeper::save(const std::string& path) const
     {
-        for (size_t y = 0; y < board_.getRows(); ++y) {
-            for (size_t x = 0; x < board_.getCols(); ++x) {
-                const auto& cell = board_({x, y});
-                if (cell.first != MINE && !cell.second) 
-                { return false; }
-            }
+        engine_.save(path);
+    }
+
+    void
+    Minesweeper::load(const std::string& path)
+    {
+        engine_.load(path);
+    }
+
+    void
+    Minesweeper::setCheckpoint(const std::string& path)
+    {
+        checkpoint_ = path;
+    }
+
+    void
+    Minesweeper::setNoGuess(const bool enabled)
+    {
+        if (enabled && !generator_) { generator_.reset(new Generator()); }
+        if (!enabled) { generator_.reset(); }
+    }
+
+    void
+    Minesweeper::setHeatmap(const bool enabled)
+    {
+        // getch() times out while the overlay is on so new results get drawn without a key
+        if (enabled && !heatmap_) {
+            heatmap_.reset(new Heatmap());
+            timeout(HEATMAP_POLL_MS);
+            requestHeatmap();
+        }
+        if (!enabled && heatmap_) {
+            heatmap_.reset();
+            probabilities_.clear();
+            heatmapChanged_ = true;
+            timeout(-1);
         }
-        
-        return true;
     }
 
-    void 
-    Minesweeper::revealAllMines() 
+    void
+    Minesweeper::requestHeatmap()
     {
-        for (size_t y = 0; y < board_.getRows(); ++y) {
-            for (size_t x = 0; x < board_.getCols(); ++x) {
-                if (board_({x, y}).first == BoardElements::MINE) {
-                    board_({x, y}).second = true;
-                }
+        if (heatmap_ && !engine_.isFirstClick() && !engine_.isGameOver()) {
+            heatmap_->request(engine_);
+            // The old odds do not hold for the new position: closed cells stay plain until the new ones arrive
+            if (!probabilities_.empty()) {
+                probabilities_.clear();
+                heatmapChanged_ = true;
             }
         }
     }
+
+    void
+    Minesweeper::openNoGuess(const Coordinate& coord)
+    {
+        const Engine::board_type& board = engine_.getBoard();
+        try { engine_ = generator_->generate(board.getRows(), board.getCols(), coord, std::random_device()()); }
+        catch (const std::runtime_error&) {
+            // Nothing solvable among the candidates: fall back to an ordinary layout
+            engine_.open(coord);
+            return;
+        }
+        engine_.setDirtyTracking(true);
+    }
 }
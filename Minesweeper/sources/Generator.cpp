@@ -0,0 +1,62 @@
+#include "headers/Generator.hpp"
+#include "headers/Solver.hpp"
+
+#include <atomic>
+#include <functional>
+#include <stdexcept>
+
+namespace SamHovhannisyan::MinesweeperGame
+{
+    namespace
+    {
+        const uint64_t NONE = uint64_t(-1);
+
+        /// Engine seed of candidate k; the odd constant spreads neighbouring candidates apart
+        uint32_t
+        candidateSeed(const uint32_t seed, const uint64_t candidate)
+        {
+            return seed + uint32_t(candidate) * 0x9E3779B9u;
+        }
+    }
+
+    Generator::Generator(const size_t threads)
+        : pool_(threads)
+        , candidates_(0)
+    {
+    }
+
+    Engine
+    Generator::generate(const size_t width, const size_t height, const Coordinate& first, const uint32_t seed,
+                        const size_t maxCandidates)
+    {
+        std::atomic<uint64_t> next(0);
+        std::atomic<uint64_t> found(NONE);
+        std::atomic<size_t> solved(0);
+
+        std::function<void()> candidate = [&]() {
+            const uint64_t index = next++;
+            if (index >= maxCandidates) { return; }
+            pool_.submit(candidate);
+
+            Engine engine(width, height, candidateSeed(seed, index));
+            engine.open(first);
+            Solver solver(engine);
+            solver.opened(engine, first);
+            solver.play(engine);
+            ++solved;
+
+            // The solver only opens cells it proved safe, so a finished game is a win
+            uint64_t none = NONE;
+            if (engine.isWin() && found.compare_exchange_strong(none, index)) { pool_.cancel(); }
+        };
+        for (size_t i = 0; i < pool_.size(); ++i) { pool_.submit(candidate); }
+        pool_.wait();
+
+        candidates_ = solved;
+        if (found == NONE) { throw std::runtime_error("No layout without guessing among the candidates"); }
+
+        Engine engine(width, height, candidateSeed(seed, found));
+        engine.open(first);
+        return engine;
+    }
+}
@@ -0,0 +1,94 @@
+#include "headers/Heatmap.hpp"
+
+namespace SamHovhannisyan::MinesweeperGame
+{
+    Heatmap::Heatmap()
+        : stop_(false)
+        , cancel_(false)
+        , rows_(0)
+        , cols_(0)
+        , mines_(0)
+        , requested_(0)
+        , ready_(false)
+    {
+        thread_ = std::thread(&Heatmap::run, this);
+    }
+
+    Heatmap::~Heatmap()
+    {
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            stop_ = true;
+            cancel_ = true;
+        }
+        wake_.notify_one();
+        thread_.join();
+    }
+
+    void
+    Heatmap::request(const Engine& engine)
+    {
+        // Only what the player sees: open numbers, every other cell closed
+        const Engine::board_type& board = engine.getBoard();
+        std::vector<int8_t> view(board.size());
+        for (size_t i = 0; i < board.size(); ++i) {
+            const Engine::Cell cell = board[i];
+            view[i] = cell.isRevealed() && !cell.isMine() ? int8_t(cell.getCount()) : Probability::CLOSED;
+        }
+
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            view_.swap(view);
+            rows_ = board.getRows();
+            cols_ = board.getCols();
+            mines_ = engine.getMinesCount();
+            ++requested_;
+            cancel_ = true;
+            // A result for the previous position that was not taken yet is stale as well
+            ready_ = false;
+        }
+        wake_.notify_one();
+    }
+
+    bool
+    Heatmap::poll(std::vector<float>& probabilities)
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        if (!ready_) { return false; }
+        probabilities.swap(result_);
+        ready_ = false;
+        return true;
+    }
+
+    void
+    Heatmap::run()
+    {
+        uint64_t taken = 0;
+        std::vector<int8_t> view;
+        std::vector<float> result;
+        while (true) {
+            size_t rows = 0;
+            size_t cols = 0;
+            size_t mines = 0;
+            {
+                std::unique_lock<std::mutex> lock(mutex_);
+                wake_.wait(lock, [this, taken]() { return stop_ || requested_ != taken; });
+                if (stop_) { return; }
+                view.swap(view_);
+                rows = rows_;
+                cols = cols_;
+                mines = mines_;
+                taken = requested_;
+                cancel_ = false;
+            }
+
+            if (!probability_.compute(view, rows, cols, mines, cancel_, result)) { continue; }
+
+            // A request that came in meanwhile makes this result stale
+            std::lock_guard<std::mutex> lock(mutex_);
+            if (requested_ != taken) { continue; }
+            result_.swap(result);
+            ready_ = true;
+        }
+    }
+}
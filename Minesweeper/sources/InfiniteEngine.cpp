@@ -0,0 +1,183 @@
+#include "../headers/InfiniteEngine.hpp"
+#include "../resources/headers/Random.hpp"
+
+#include <array>
+#include <vector>
+
+namespace SamHovhannisyan::MinesweeperGame
+{
+    namespace
+    {
+        /// No mine is laid within this distance of the first click
+        const size_t SAFE_RADIUS = 2;
+        /// Share of mines, the density of the fixed-size Engine
+        const uint64_t MINE_PERCENT = 17;
+        /// Step between the hash inputs of two cells of a chunk, the SplitMix64 increment
+        const uint64_t CELL_STEP = 0x9E3779B97F4A7C15ull;
+    }
+
+    InfiniteEngine::InfiniteEngine(const uint64_t seed, const size_t chunks)
+        : seed_(seed)
+        , board_(SIDE, SIDE, cell_type(), chunks)
+        , built_(0)
+    {
+        board_.setTileLoader([this](const chunk_key key, board_type::Tile& tile) { build(key, tile); return true; });
+        board_.setTileEvictor([this](const chunk_key key, const board_type::Tile& tile) { keep(key, tile); });
+        reset();
+    }
+
+    void
+    InfiniteEngine::reset()
+    {
+        board_.clear();
+        saved_.clear();
+        first_click_ = true;
+        game_over_ = false;
+        opened_ = 0;
+        flags_placed_ = 0;
+    }
+
+    void
+    InfiniteEngine::open(const Coordinate& coord)
+    {
+        if (game_over_ || coord.x >= SIDE || coord.y >= SIDE) { return; }
+
+        // The safe zone changes the mines around the click, so chunks read before are dropped
+        if (first_click_) {
+            first_click_ = false;
+            first_ = coord;
+            board_.clear();
+            saved_.clear();
+        }
+
+        // References into the board only live until the next access, so the cell is copied
+        const cell_type current = board_(coord);
+        if (current.isFlagged() || current.isRevealed()) { return; }
+        board_(coord).setRevealed(true);
+
+        if (current.isMine()) {
+            game_over_ = true;
+            return;
+        }
+
+        ++opened_;
+        if (current.getCount() == 0) { openEmptysFrom(coord); }
+    }
+
+    void
+    InfiniteEngine::toggleFlag(const Coordinate& coord)
+    {
+        if (game_over_ || first_click_ || coord.x >= SIDE || coord.y >= SIDE) { return; }
+        cell_type& cell = board_(coord);
+        if (cell.isRevealed()) { return; }
+        cell.setFlagged(!cell.isFlagged());
+        if (cell.isFlagged()) { ++flags_placed_; }
+        else { --flags_placed_; }
+    }
+
+    bool
+    InfiniteEngine::isMine(const Coordinate& coord) const
+    {
+        return isMine(seedOf(board_type::keyOf(coord)), coord.x, coord.y);
+    }
+
+    uint64_t
+    InfiniteEngine::seedOf(const chunk_key key) const
+    {
+        return Random::SplitMix64(seed_ ^ Random::SplitMix64(key)())();
+    }
+
+    bool
+    InfiniteEngine::isMine(const uint64_t chunkSeed, const size_t x, const size_t y) const
+    {
+        if (!first_click_ && x + SAFE_RADIUS >= first_.x && x <= first_.x + SAFE_RADIUS
+                          && y + SAFE_RADIUS >= first_.y && y <= first_.y + SAFE_RADIUS) { return false; }
+
+        // The i-th output of a SplitMix64 stream is a hash of its seed and i, so a cell is
+        // drawn on its own without running the chunk's stream up to it
+        const uint64_t cell = (y % CHUNK_SIZE) * CHUNK_SIZE + x % CHUNK_SIZE;
+        return Random::SplitMix64(chunkSeed + cell * CELL_STEP).below(100) < MINE_PERCENT;
+    }
+
+    void
+    InfiniteEngine::build(const chunk_key key, board_type::Tile& tile)
+    {
+        const Coordinate origin = board_type::originOf(key);
+        const size_t RING = CHUNK_SIZE + 2;
+
+        // The chunk and a ring of one cell around it, which belongs to the 8 chunks around
+        std::array<uint64_t, 9> seeds;
+        for (size_t cy = 0; cy < 3; ++cy) {
+            for (size_t cx = 0; cx < 3; ++cx) {
+                const size_t x = origin.x + cx * CHUNK_SIZE - CHUNK_SIZE;
+                const size_t y = origin.y + cy * CHUNK_SIZE - CHUNK_SIZE;
+                seeds[cy * 3 + cx] = x < SIDE && y < SIDE ? seedOf(board_type::keyOf({ x, y })) : 0;
+            }
+        }
+        std::array<uint8_t, RING * RING> mines;
+        for (size_t ry = 0; ry < RING; ++ry) {
+            const size_t y = origin.y + ry - 1;
+            const size_t cy = ry == 0 ? 0 : ry == RING - 1 ? 2 : 1;
+            for (size_t rx = 0; rx < RING; ++rx) {
+                const size_t x = origin.x + rx - 1;
+                const size_t cx = rx == 0 ? 0 : rx == RING - 1 ? 2 : 1;
+                mines[ry * RING + rx] = x < SIDE && y < SIDE && isMine(seeds[cy * 3 + cx], x, y);
+            }
+        }
+
+        const auto progress = saved_.find(key);
+        for (size_t y = 0; y < CHUNK_SIZE; ++y) {
+            for (size_t x = 0; x < CHUNK_SIZE; ++x) {
+                const uint8_t* above = &mines[y * RING + x];
+                const uint8_t count = above[0] + above[1] + above[2]
+                                    + above[RING] + above[RING + 2]
+                                    + above[2 * RING] + above[2 * RING + 1] + above[2 * RING + 2];
+                cell_type& cell = tile.cells[y * CHUNK_SIZE + x];
+                cell = cell_type(count);
+                cell.setMine(above[RING + 1]);
+                if (progress != saved_.end()) {
+                    cell.setRevealed(progress->second.revealed[y * CHUNK_SIZE + x]);
+                    cell.setFlagged(progress->second.flagged[y * CHUNK_SIZE + x]);
+                }
+            }
+        }
+
+        // The tile holds the progress again until it is evicted
+        if (progress != saved_.end()) { saved_.erase(progress); }
+        ++built_;
+    }
+
+    void
+    InfiniteEngine::keep(const chunk_key key, const board_type::Tile& tile)
+    {
+        Progress progress;
+        for (size_t cell = 0; cell < tile.cells.size(); ++cell) {
+            progress.revealed[cell] = tile.cells[cell].isRevealed();
+            progress.flagged[cell] = tile.cells[cell].isFlagged();
+        }
+        if (progress.revealed.any() || progress.flagged.any()) { saved_[key] = progress; }
+    }
+
+    void
+    InfiniteEngine::openEmptysFrom(const Coordinate& coord)
+    {
+        // A cell has no mine around it with probability 0.83^9 < 0.19, far below the 0.41 at
+        // which such cells would join up into an endless region, so every fill ends
+        std::vector<Coordinate> to_open(1, coord);
+        while (!to_open.empty()) {
+            const Coordinate current = to_open.back();
+            to_open.pop_back();
+            for (int dy = -1; dy <= 1; ++dy) {
+                for (int dx = -1; dx <= 1; ++dx) {
+                    const Coordinate next(current.x + dx, current.y + dy);
+                    if ((dx == 0 && dy == 0) || next.x >= SIDE || next.y >= SIDE) { continue; }
+                    cell_type& neighbour = board_(next);
+                    if (neighbour.isRevealed() || neighbour.isFlagged()) { continue; }
+                    neighbour.setRevealed(true);
+                    ++opened_;
+                    if (neighbour.getElement() == Engine::EMPTY) { to_open.push_back(next); }
+                }
+            }
+        }
+    }
+}
@@ -0,0 +1,122 @@
+#include "../headers/InfiniteGame.hpp"
+#include <ncurses.h>
+
+namespace SamHovhannisyan::MinesweeperGame
+{
+    namespace
+    {
+        const int BOARD_START_X = 0;
+        const int BOARD_START_Y = 2;
+        const int CELL_WIDTH = 3;
+        /// Cells the camera moves per arrow key
+        const size_t SCROLL_STEP = 4;
+
+        size_t visibleCols() { return COLS > BOARD_START_X ? (COLS - BOARD_START_X) / CELL_WIDTH : 0; }
+        size_t visibleRows() { return LINES > BOARD_START_Y + 2 ? LINES - BOARD_START_Y - 2 : 0; }
+    }
+
+    InfiniteMinesweeper::InfiniteMinesweeper()
+        : quit_(false)
+    {
+        // Initialize ncurses
+        initscr();
+        cbreak();
+        noecho();
+        keypad(stdscr, TRUE);
+        mousemask(BUTTON1_CLICKED | BUTTON3_CLICKED, NULL);
+        curs_set(0); // Hide cursor
+
+        center();
+    }
+
+    void
+    InfiniteMinesweeper::drawBoard() const
+    {
+        erase();
+        for (size_t y = 0; y < visibleRows(); ++y) {
+            for (size_t x = 0; x < visibleCols(); ++x) {
+                drawCell({ camera_.x + x, camera_.y + y }, BOARD_START_Y + y, BOARD_START_X + x * CELL_WIDTH);
+            }
+        }
+
+        attron(A_BOLD);
+        mvprintw(0, 0, "Minesweeper - Opened: %zu | Flags: %zu | Chunks: %zu resident, %zu saved",
+                 engine_.getOpened(), engine_.getFlagsPlaced(), engine_.getChunksResident(), engine_.getChunksSaved());
+        attroff(A_BOLD);
+        mvprintw(LINES - 1, 0, "Left-click: Open cell | Right-click: Place flag | Arrows: Scroll | 'c': Center | 'q': Quit");
+        refresh();
+    }
+
+    void
+    InfiniteMinesweeper::drawCell(const Coordinate& coord, const int row, const int column) const
+    {
+        const InfiniteEngine::cell_type current = engine_.getCell(coord);
+        move(row, column);
+        if (current.isFlagged()) { printw("[F]"); }
+        else if (!current.isRevealed()) { printw("[ ]"); }
+        else if (current.isMine()) { printw("[*]"); }
+        else if (current.getCount() == 0) { printw("   "); }
+        else { printw("[%d]", current.getCount()); }
+    }
+
+    void
+    InfiniteMinesweeper::handleInput()
+    {
+        MEVENT event;
+        switch (getch())
+        {
+        case 'q': quit_ = true; break;
+        case 'c': center(); break;
+        case KEY_UP:    camera_.y -= SCROLL_STEP; break;
+        case KEY_DOWN:  camera_.y += SCROLL_STEP; break;
+        case KEY_LEFT:  camera_.x -= SCROLL_STEP; break;
+        case KEY_RIGHT: camera_.x += SCROLL_STEP; break;
+        case KEY_MOUSE:
+            if (getmouse(&event) != OK || event.y < BOARD_START_Y || event.x < BOARD_START_X) { break; }
+            {
+                const size_t x = (event.x - BOARD_START_X) / CELL_WIDTH;
+                const size_t y = event.y - BOARD_START_Y;
+                if (x >= visibleCols() || y >= visibleRows()) { break; }
+
+                const Coordinate coord(camera_.x + x, camera_.y + y);
+                if (event.bstate & BUTTON1_CLICKED) { engine_.open(coord); }
+                else if (event.bstate & BUTTON3_CLICKED) { engine_.toggleFlag(coord); }
+            }
+            break;
+        }
+    }
+
+    void
+    InfiniteMinesweeper::center()
+    {
+        const Coordinate origin = InfiniteEngine::getOrigin();
+        camera_ = Coordinate(origin.x - visibleCols() / 2, origin.y - visibleRows() / 2);
+    }
+
+    void
+    InfiniteMinesweeper::start()
+    {
+        while (!engine_.isGameOver() && !quit_)
+        {
+            drawBoard();
+            handleInput();
+        }
+
+        if (engine_.isGameOver()) {
+            // Leave the board with the mine on screen for a moment
+            drawBoard();
+            napms(1000);
+        }
+
+        clear();
+        if (engine_.isGameOver()) { printw("Game Over! You hit a mine after opening %zu cells!\n", engine_.getOpened()); }
+        else { printw("You opened %zu cells.\n", engine_.getOpened()); }
+
+        printw("Press any key to exit...");
+        refresh();
+        flushinp();
+        getch();
+
+        endwin(); // Clean up ncurses
+    }
+}
@@ -0,0 +1,367 @@
+#include "headers/Probability.hpp"
+
+#include "../resources/headers/Neighbours.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+namespace SamHovhannisyan::MinesweeperGame
+{
+    namespace
+    {
+        /// Neighbours of a cell; the scope of a variable has as many slots
+        const size_t SURROUNDING = 8;
+        /// The search looks at the cancel flag once per this many nodes
+        const size_t CANCEL_CHECK_MASK = 0xFFF;
+
+        /// Scale a polynomial so that its largest coefficient is 1
+        void
+        normalize(std::vector<double>& polynomial, std::vector<double>* alongside = nullptr)
+        {
+            const double largest = *std::max_element(polynomial.begin(), polynomial.end());
+            if (largest == 0) { return; }
+            for (double& value : polynomial) { value /= largest; }
+            if (alongside != nullptr) {
+                for (double& value : *alongside) { value /= largest; }
+            }
+        }
+
+        std::vector<double>
+        convolve(const std::vector<double>& lhv, const std::vector<double>& rhv)
+        {
+            std::vector<double> product(lhv.size() + rhv.size() - 1, 0.0);
+            for (size_t i = 0; i < lhv.size(); ++i) {
+                if (lhv[i] == 0) { continue; }
+                for (size_t j = 0; j < rhv.size(); ++j) { product[i + j] += lhv[i] * rhv[j]; }
+            }
+            normalize(product);
+            return product;
+        }
+
+        double
+        logChoose(const size_t n, const size_t k)
+        {
+            return std::lgamma(n + 1.0) - std::lgamma(k + 1.0) - std::lgamma(n - k + 1.0);
+        }
+    }
+
+    Probability::Probability()
+        : rows_(0)
+        , cols_(0)
+        , now_(0)
+        , enumerated_(0)
+        , cached_(0)
+        , unsolved_(0)
+        , current_(nullptr)
+        , nodes_(0)
+    {
+    }
+
+    bool
+    Probability::compute(const std::vector<int8_t>& view, const size_t rows, const size_t cols, const size_t mines,
+                         const std::atomic<bool>& cancel, std::vector<float>& out)
+    {
+        // A cached component is only valid on a board of the same shape
+        if (rows != rows_ || cols != cols_) { cache_.clear(); }
+        rows_ = rows;
+        cols_ = cols;
+        ++now_;
+        enumerated_ = 0;
+        cached_ = 0;
+        unsolved_ = 0;
+        seen_.assign(view.size(), 0);
+        known_.assign(view.size(), UNKNOWN);
+        slot_.resize(view.size());
+        out.assign(view.size(), NONE);
+
+        const size_t certain = settle(view);
+        const size_t left = certain <= mines ? mines - certain : 0;
+        for (size_t cell = 0; cell < view.size(); ++cell) {
+            if (known_[cell] != UNKNOWN) { out[cell] = known_[cell] == MINE ? 1.0f : 0.0f; }
+        }
+
+        // Split the other closed cells into components and cells no number touches
+        std::vector<const Component*> parts;
+        std::vector<std::vector<uint32_t>> cells;
+        std::vector<uint32_t> unconstrained;
+        uint32_t around[SURROUNDING];
+        for (uint32_t cell = 0; cell < view.size(); ++cell) {
+            if (!isVariable(view, cell) || seen_[cell]) { continue; }
+            const size_t count = neighbours(cell, around);
+            const bool frontier = std::any_of(around, around + count, [&view](const uint32_t n) { return view[n] != CLOSED; });
+            if (!frontier) {
+                unconstrained.push_back(cell);
+                continue;
+            }
+
+            collect(view, cell);
+            const Component* component = solve(view, cancel);
+            if (component == nullptr) { return false; }
+            if (!component->solved) {
+                unsolved_ += variables_.size();
+                unconstrained.insert(unconstrained.end(), variables_.begin(), variables_.end());
+                continue;
+            }
+            parts.push_back(component);
+            cells.push_back(variables_);
+        }
+
+        // Solutions of the components before each one, by number of mines
+        std::vector<std::vector<double>> prefix(parts.size() + 1, std::vector<double>(1, 1.0));
+        for (size_t i = 0; i < parts.size(); ++i) {
+            prefix[i + 1] = convolve(prefix[i], parts[i]->solutions);
+            if (cancel.load(std::memory_order_relaxed)) { return false; }
+        }
+
+        // weight[m]: ways to put the remaining mines on the unconstrained cells when the frontier
+        // holds m, relative to the likeliest m
+        const std::vector<double>& frontier = prefix.back();
+        const size_t rest = unconstrained.size();
+        std::vector<double> weight(frontier.size(), 0.0);
+        double heaviest = -std::numeric_limits<double>::infinity();
+        for (size_t m = 0; m < weight.size(); ++m) {
+            if (m <= left && left - m <= rest) { heaviest = std::max(heaviest, logChoose(rest, left - m)); }
+        }
+        for (size_t m = 0; m < weight.size(); ++m) {
+            if (m <= left && left - m <= rest) { weight[m] = std::exp(logChoose(rest, left - m) - heaviest); }
+        }
+
+        // Walking back from the last component, after[t] is the weight of the components after
+        // the current one and the unconstrained cells when the ones before hold t mines; each
+        // step costs the length of one component's polynomial per entry, not a convolution
+        std::vector<double> after = weight;
+        std::vector<double> reach;
+        for (size_t part = parts.size(); part-- > 0; ) {
+            const std::vector<double>& before = prefix[part];
+            const std::vector<double>& solutions = parts[part]->solutions;
+            reach.assign(solutions.size(), 0.0);
+            for (size_t k = 0; k < solutions.size(); ++k) {
+                for (size_t i = 0; i < before.size() && i + k < after.size(); ++i) { reach[k] += before[i] * after[i + k]; }
+            }
+
+            double total = 0;
+            for (size_t k = 0; k < solutions.size(); ++k) { total += solutions[k] * reach[k]; }
+            const double* counts = parts[part]->mines.data();
+            for (size_t i = 0; total != 0 && i < cells[part].size(); ++i, counts += solutions.size()) {
+                double mine = 0;
+                for (size_t k = 0; k < solutions.size(); ++k) { mine += counts[k] * reach[k]; }
+                out[cells[part][i]] = float(mine / total);
+            }
+
+            // Fold this component into after, for the one before it
+            const size_t length = after.size() + 1 - solutions.size();
+            for (size_t t = 0; t < length; ++t) {
+                double sum = 0;
+                for (size_t k = 0; k < solutions.size(); ++k) { sum += solutions[k] * after[t + k]; }
+                after[t] = sum;
+            }
+            after.resize(length);
+            normalize(after);
+            if (cancel.load(std::memory_order_relaxed)) { return false; }
+        }
+
+        // The unconstrained cells share the mines the frontier leaves, evenly
+        double total = 0;
+        double expected = 0;
+        for (size_t m = 0; m < frontier.size(); ++m) {
+            total += frontier[m] * weight[m];
+            if (m <= left) { expected += frontier[m] * weight[m] * double(left - m); }
+        }
+        if (rest != 0 && total != 0) {
+            for (const uint32_t cell : unconstrained) { out[cell] = float(expected / total / rest); }
+        }
+
+        // Components no longer on the board will not come back
+        for (auto entry = cache_.begin(); entry != cache_.end(); ) {
+            if (entry->second.used != now_) { entry = cache_.erase(entry); }
+            else { ++entry; }
+        }
+        return true;
+    }
+
+    size_t
+    Probability::neighbours(const uint32_t cell, uint32_t* out) const
+    {
+        const size_t x = cell % cols_;
+        const size_t y = cell / cols_;
+        size_t count = 0;
+        for (const Neighbours::Offset& offset : Neighbours::SURROUNDING) {
+            const size_t nx = x + offset.dx;
+            const size_t ny = y + offset.dy;
+            if (nx < cols_ && ny < rows_) { out[count++] = ny * cols_ + nx; }
+        }
+        return count;
+    }
+
+    bool
+    Probability::isVariable(const std::vector<int8_t>& view, const uint32_t cell) const
+    {
+        return view[cell] == CLOSED && known_[cell] == UNKNOWN;
+    }
+
+    int
+    Probability::missing(const std::vector<int8_t>& view, const uint32_t number) const
+    {
+        uint32_t around[SURROUNDING];
+        const size_t count = neighbours(number, around);
+        int missing = view[number];
+        for (size_t i = 0; i < count; ++i) { missing -= known_[around[i]] == MINE; }
+        return missing;
+    }
+
+    size_t
+    Probability::settle(const std::vector<int8_t>& view)
+    {
+        uint32_t around[SURROUNDING];
+        uint32_t further[SURROUNDING];
+        std::vector<uint32_t> queue;
+        for (uint32_t cell = 0; cell < view.size(); ++cell) {
+            if (view[cell] != CLOSED) { queue.push_back(cell); }
+        }
+
+        size_t mines = 0;
+        while (!queue.empty()) {
+            const uint32_t number = queue.back();
+            queue.pop_back();
+            const size_t count = neighbours(number, around);
+            const int unknown = std::count_if(around, around + count, [this, &view](const uint32_t n) { return isVariable(view, n); });
+            if (unknown == 0) { continue; }
+            const int left = missing(view, number);
+            if (left != 0 && left != unknown) { continue; }
+
+            // Every closed cell around is decided; the numbers next to them may now decide more
+            for (size_t i = 0; i < count; ++i) {
+                if (!isVariable(view, around[i])) { continue; }
+                known_[around[i]] = left == 0 ? SAFE : MINE;
+                mines += left != 0;
+                const size_t furtherCount = neighbours(around[i], further);
+                for (size_t j = 0; j < furtherCount; ++j) {
+                    if (view[further[j]] != CLOSED) { queue.push_back(further[j]); }
+                }
+            }
+        }
+        return mines;
+    }
+
+    void
+    Probability::collect(const std::vector<int8_t>& view, const uint32_t start)
+    {
+        // Every closed neighbour of a number belongs to the same component, so the order in
+        // which cells are found depends on the component alone
+        uint32_t around[SURROUNDING];
+        uint32_t closed[SURROUNDING];
+        variables_.assign(1, start);
+        constraints_.clear();
+        seen_[start] = 1;
+        for (size_t i = 0; i < variables_.size(); ++i) {
+            const size_t count = neighbours(variables_[i], around);
+            for (size_t j = 0; j < count; ++j) {
+                const uint32_t number = around[j];
+                if (view[number] == CLOSED || seen_[number]) { continue; }
+                seen_[number] = 1;
+                constraints_.push_back(number);
+
+                const size_t closedCount = neighbours(number, closed);
+                for (size_t k = 0; k < closedCount; ++k) {
+                    if (!isVariable(view, closed[k]) || seen_[closed[k]]) { continue; }
+                    seen_[closed[k]] = 1;
+                    variables_.push_back(closed[k]);
+                }
+            }
+        }
+    }
+
+    const Probability::Component*
+    Probability::solve(const std::vector<int8_t>& view, const std::atomic<bool>& cancel)
+    {
+        // The cells and the mines still missing around the numbers are all the enumeration
+        // depends on
+        std::string key(reinterpret_cast<const char*>(variables_.data()), variables_.size() * sizeof(uint32_t));
+        key.push_back('\0');
+        for (const uint32_t number : constraints_) {
+            key.append(reinterpret_cast<const char*>(&number), sizeof(number));
+            key.push_back(char(missing(view, number)));
+        }
+        const auto found = cache_.find(key);
+        if (found != cache_.end()) {
+            found->second.used = now_;
+            ++cached_;
+            return &found->second;
+        }
+
+        const size_t count = variables_.size();
+        Component component;
+        component.solved = false;
+        component.used = now_;
+
+        if (count <= MAX_COMPONENT) {
+            component.solutions.assign(count + 1, 0.0);
+            component.mines.assign(count * (count + 1), 0.0);
+            uint32_t around[SURROUNDING];
+            missing_.resize(constraints_.size());
+            open_.resize(constraints_.size());
+            for (size_t k = 0; k < constraints_.size(); ++k) {
+                slot_[constraints_[k]] = k;
+                const size_t aroundCount = neighbours(constraints_[k], around);
+                missing_[k] = missing(view, constraints_[k]);
+                open_[k] = std::count_if(around, around + aroundCount, [this, &view](const uint32_t n) { return isVariable(view, n); });
+            }
+            scope_.resize(count * SURROUNDING);
+            scopeSize_.assign(count, 0);
+            for (size_t i = 0; i < count; ++i) {
+                const size_t aroundCount = neighbours(variables_[i], around);
+                for (size_t j = 0; j < aroundCount; ++j) {
+                    if (view[around[j]] != CLOSED) { scope_[i * SURROUNDING + scopeSize_[i]++] = slot_[around[j]]; }
+                }
+            }
+
+            assignment_.assign(count, 0);
+            current_ = &component;
+            nodes_ = 0;
+            const bool complete = search(0, 0, cancel);
+            if (!complete && cancel.load(std::memory_order_relaxed)) { return nullptr; }
+            component.solved = complete && *std::max_element(component.solutions.begin(), component.solutions.end()) != 0;
+            if (component.solved) { normalize(component.solutions, &component.mines); }
+        }
+
+        ++enumerated_;
+        return &(cache_[key] = std::move(component));
+    }
+
+    bool
+    Probability::search(const size_t variable, const size_t mines, const std::atomic<bool>& cancel)
+    {
+        if (++nodes_ > MAX_NODES) { return false; }
+        if ((nodes_ & CANCEL_CHECK_MASK) == 0 && cancel.load(std::memory_order_relaxed)) { return false; }
+        const size_t count = variables_.size();
+        if (variable == count) {
+            current_->solutions[mines] += 1;
+            for (size_t i = 0; i < count; ++i) {
+                if (assignment_[i]) { current_->mines[i * (count + 1) + mines] += 1; }
+            }
+            return true;
+        }
+
+        const uint32_t* scope = scope_.data() + variable * SURROUNDING;
+        bool complete = true;
+        for (int mine = 0; mine <= 1 && complete; ++mine) {
+            // Every number must keep between 0 and its remaining closed cells missing
+            bool consistent = true;
+            for (size_t i = 0; i < scopeSize_[variable]; ++i) {
+                --open_[scope[i]];
+                missing_[scope[i]] -= mine;
+                if (missing_[scope[i]] < 0 || missing_[scope[i]] > open_[scope[i]]) { consistent = false; }
+            }
+            if (consistent) {
+                assignment_[variable] = mine;
+                complete = search(variable + 1, mines + mine, cancel);
+            }
+            for (size_t i = 0; i < scopeSize_[variable]; ++i) {
+                ++open_[scope[i]];
+                missing_[scope[i]] += mine;
+            }
+        }
+        return complete;
+    }
+}
@@ -0,0 +1,377 @@
+#include "headers/Solver.hpp"
+
+#include "../resources/headers/Neighbours.hpp"
+
+#include <algorithm>
+
+namespace SamHovhannisyan::MinesweeperGame
+{
+    namespace
+    {
+        /// Neighbours of a cell; the scope of a variable has as many slots
+        const size_t SURROUNDING = 8;
+
+        bool
+        contains(const uint32_t* cells, const size_t count, const uint32_t cell)
+        {
+            return std::find(cells, cells + count, cell) != cells + count;
+        }
+
+        bool
+        isSubset(const uint32_t* lhv, const size_t lhvCount, const uint32_t* rhv, const size_t rhvCount)
+        {
+            for (size_t i = 0; i < lhvCount; ++i) {
+                if (!contains(rhv, rhvCount, lhv[i])) { return false; }
+            }
+            return true;
+        }
+    }
+
+    Solver::Solver(const Engine& engine)
+        : cols_(engine.getBoard().getCols())
+        , rows_(engine.getBoard().getRows())
+        , state_(cols_ * rows_)
+        , queued_(cols_ * rows_)
+        , changed_(cols_ * rows_)
+        , stamp_(cols_ * rows_)
+        , slot_(cols_ * rows_)
+    {
+        reset();
+    }
+
+    void
+    Solver::reset()
+    {
+        std::fill(state_.begin(), state_.end(), UNKNOWN);
+        std::fill(queued_.begin(), queued_.end(), 0);
+        std::fill(changed_.begin(), changed_.end(), 0);
+        std::fill(stamp_.begin(), stamp_.end(), 0);
+        stampNow_ = 0;
+        queue_.clear();
+        touched_.clear();
+        safe_.clear();
+        deduced_ = 0;
+    }
+
+    void
+    Solver::opened(const Engine& engine, const Coordinate& coord)
+    {
+        const Engine::board_type& board = engine.getBoard();
+        cell_type around[SURROUNDING];
+
+        // Follow the flood fill of the engine through the open empty cells
+        variables_.assign(1, coord.y * cols_ + coord.x);
+        while (!variables_.empty()) {
+            const cell_type cell = variables_.back();
+            variables_.pop_back();
+            if (state_[cell] == OPEN || !board[cell].isRevealed()) { continue; }
+            if (board[cell].isMine()) {
+                state_[cell] = MINE;
+                continue;
+            }
+
+            state_[cell] = OPEN;
+            queue(cell);
+            const bool empty = board[cell].getElement() == Engine::EMPTY;
+            const size_t count = neighbours(cell, around);
+            for (size_t i = 0; i < count; ++i) {
+                if (state_[around[i]] == OPEN) { queue(around[i]); }
+                else if (empty) { variables_.push_back(around[i]); }
+            }
+        }
+    }
+
+    bool
+    Solver::solve(const Engine& engine)
+    {
+        while (true) {
+            propagate(engine);
+            if (hasSafe()) { return true; }
+            if (!enumerate(engine)) { return false; }
+        }
+    }
+
+    bool
+    Solver::nextSafe(Coordinate& coord)
+    {
+        if (!hasSafe()) { return false; }
+        coord = Coordinate(safe_.back() % cols_, safe_.back() / cols_);
+        safe_.pop_back();
+        return true;
+    }
+
+    size_t
+    Solver::play(Engine& engine)
+    {
+        size_t moves = 0;
+        Coordinate coord;
+        while (!engine.isGameOver() && solve(engine)) {
+            while (!engine.isGameOver() && nextSafe(coord)) {
+                engine.open(coord);
+                opened(engine, coord);
+                ++moves;
+            }
+        }
+        return moves;
+    }
+
+    bool
+    Solver::hasSafe()
+    {
+        while (!safe_.empty() && state_[safe_.back()] != SAFE) { safe_.pop_back(); }
+        return !safe_.empty();
+    }
+
+    size_t
+    Solver::neighbours(const cell_type cell, cell_type* out) const
+    {
+        const size_t x = cell % cols_;
+        const size_t y = cell / cols_;
+        size_t count = 0;
+        for (const Neighbours::Offset& offset : Neighbours::SURROUNDING) {
+            const size_t nx = x + offset.dx;
+            const size_t ny = y + offset.dy;
+            if (nx < cols_ && ny < rows_) { out[count++] = ny * cols_ + nx; }
+        }
+        return count;
+    }
+
+    size_t
+    Solver::unknowns(const Engine& engine, const cell_type cell, cell_type* out, int& missing) const
+    {
+        cell_type around[SURROUNDING];
+        const size_t count = neighbours(cell, around);
+        size_t unknown = 0;
+        missing = engine.getBoard()[cell].getCount();
+        for (size_t i = 0; i < count; ++i) {
+            if (state_[around[i]] == MINE) { --missing; }
+            else if (state_[around[i]] == UNKNOWN) { out[unknown++] = around[i]; }
+        }
+        return unknown;
+    }
+
+    void
+    Solver::queue(const cell_type cell)
+    {
+        if (!queued_[cell]) {
+            queued_[cell] = 1;
+            queue_.push_back(cell);
+        }
+        changed(cell);
+    }
+
+    void
+    Solver::changed(const cell_type cell)
+    {
+        cell_type around[SURROUNDING];
+        const size_t count = neighbours(cell, around);
+        for (size_t i = 0; i < count; ++i) {
+            if (state_[around[i]] == UNKNOWN && !changed_[around[i]]) {
+                changed_[around[i]] = 1;
+                touched_.push_back(around[i]);
+            }
+        }
+    }
+
+    void
+    Solver::mark(const cell_type cell, const Knowledge knowledge)
+    {
+        if (state_[cell] != UNKNOWN) { return; }
+        state_[cell] = knowledge;
+        ++deduced_;
+        if (knowledge == SAFE) { safe_.push_back(cell); }
+
+        cell_type around[SURROUNDING];
+        const size_t count = neighbours(cell, around);
+        for (size_t i = 0; i < count; ++i) {
+            if (state_[around[i]] == OPEN) { queue(around[i]); }
+        }
+    }
+
+    void
+    Solver::markAll(const cell_type* cells, const size_t count, const Knowledge knowledge)
+    {
+        for (size_t i = 0; i < count; ++i) { mark(cells[i], knowledge); }
+    }
+
+    bool
+    Solver::propagate(const Engine& engine)
+    {
+        bool progress = false;
+        cell_type unknown[SURROUNDING];
+        while (!queue_.empty()) {
+            const cell_type cell = queue_.back();
+            queue_.pop_back();
+            queued_[cell] = 0;
+            if (state_[cell] != OPEN) { continue; }
+
+            int missing = 0;
+            const size_t count = unknowns(engine, cell, unknown, missing);
+            if (count == 0) { continue; }
+            if (missing == 0) {
+                markAll(unknown, count, SAFE);
+                progress = true;
+            } else if (missing == int(count)) {
+                markAll(unknown, count, MINE);
+                progress = true;
+            } else if (subsets(engine, cell, unknown, count, missing)) {
+                progress = true;
+            }
+        }
+        return progress;
+    }
+
+    bool
+    Solver::subsets(const Engine& engine, const cell_type cell, const cell_type* unknown, const size_t count, const int missing)
+    {
+        // Numbers sharing a closed cell with this one are at most two cells away
+        const size_t x = cell % cols_;
+        const size_t y = cell / cols_;
+        cell_type other[SURROUNDING];
+        cell_type difference[SURROUNDING];
+        for (size_t ny = y < 2 ? 0 : y - 2; ny <= std::min(y + 2, rows_ - 1); ++ny) {
+            for (size_t nx = x < 2 ? 0 : x - 2; nx <= std::min(x + 2, cols_ - 1); ++nx) {
+                const cell_type neighbour = ny * cols_ + nx;
+                if (neighbour == cell || state_[neighbour] != OPEN) { continue; }
+
+                int otherMissing = 0;
+                const size_t otherCount = unknowns(engine, neighbour, other, otherMissing);
+                const bool smaller = count < otherCount;
+                const cell_type* small = smaller ? unknown : other;
+                const cell_type* large = smaller ? other : unknown;
+                const size_t smallCount = smaller ? count : otherCount;
+                const size_t largeCount = smaller ? otherCount : count;
+                if (smallCount == largeCount || !isSubset(small, smallCount, large, largeCount)) { continue; }
+
+                // The cells only the larger set has hold the difference of the counts
+                size_t differenceCount = 0;
+                for (size_t i = 0; i < largeCount; ++i) {
+                    if (!contains(small, smallCount, large[i])) { difference[differenceCount++] = large[i]; }
+                }
+                const int mines = smaller ? otherMissing - missing : missing - otherMissing;
+                if (mines != 0 && mines != int(differenceCount)) { continue; }
+
+                markAll(difference, differenceCount, mines == 0 ? SAFE : MINE);
+                queue(cell);
+                return true;
+            }
+        }
+        return false;
+    }
+
+    bool
+    Solver::enumerate(const Engine& engine)
+    {
+        // Deductions flag more cells while this runs; they are picked up by the same loop
+        bool progress = false;
+        for (size_t i = 0; i < touched_.size(); ++i) {
+            const cell_type cell = touched_[i];
+            if (!changed_[cell]) { continue; }
+            if (state_[cell] != UNKNOWN) {
+                changed_[cell] = 0;
+                continue;
+            }
+            if (solveComponent(engine, cell)) { progress = true; }
+        }
+        touched_.clear();
+        return progress;
+    }
+
+    bool
+    Solver::solveComponent(const Engine& engine, const cell_type start)
+    {
+        if (++stampNow_ == 0) {
+            std::fill(stamp_.begin(), stamp_.end(), 0);
+            stampNow_ = 1;
+        }
+
+        // Closed cells linked by the numbers they share, breadth first so the search order
+        // follows the frontier and constraints close early
+        cell_type around[SURROUNDING];
+        cell_type unknown[SURROUNDING];
+        variables_.assign(1, start);
+        constraints_.clear();
+        stamp_[start] = stampNow_;
+        slot_[start] = 0;
+        for (size_t i = 0; i < variables_.size(); ++i) {
+            changed_[variables_[i]] = 0;
+            const size_t count = neighbours(variables_[i], around);
+            for (size_t j = 0; j < count; ++j) {
+                const cell_type number = around[j];
+                if (state_[number] != OPEN || stamp_[number] == stampNow_) { continue; }
+                stamp_[number] = stampNow_;
+                slot_[number] = constraints_.size();
+                constraints_.push_back(number);
+
+                int missing = 0;
+                const size_t unknownCount = unknowns(engine, number, unknown, missing);
+                for (size_t k = 0; k < unknownCount; ++k) {
+                    if (stamp_[unknown[k]] == stampNow_) { continue; }
+                    stamp_[unknown[k]] = stampNow_;
+                    slot_[unknown[k]] = variables_.size();
+                    variables_.push_back(unknown[k]);
+                }
+            }
+        }
+        if (constraints_.empty() || variables_.size() > MAX_COMPONENT) { return false; }
+
+        missing_.resize(constraints_.size());
+        open_.resize(constraints_.size());
+        for (size_t k = 0; k < constraints_.size(); ++k) {
+            open_[k] = unknowns(engine, constraints_[k], unknown, missing_[k]);
+        }
+        scope_.resize(variables_.size() * SURROUNDING);
+        scopeSize_.assign(variables_.size(), 0);
+        for (size_t i = 0; i < variables_.size(); ++i) {
+            const size_t count = neighbours(variables_[i], around);
+            for (size_t j = 0; j < count; ++j) {
+                if (state_[around[j]] == OPEN) { scope_[i * SURROUNDING + scopeSize_[i]++] = slot_[around[j]]; }
+            }
+        }
+
+        assignment_.assign(variables_.size(), 0);
+        mineSolutions_.assign(variables_.size(), 0);
+        solutions_ = 0;
+        size_t nodes = 0;
+        search(0, nodes);
+        if (nodes > MAX_NODES || solutions_ == 0) { return false; }
+
+        bool progress = false;
+        for (size_t i = 0; i < variables_.size(); ++i) {
+            if (mineSolutions_[i] != 0 && mineSolutions_[i] != solutions_) { continue; }
+            mark(variables_[i], mineSolutions_[i] == 0 ? SAFE : MINE);
+            progress = true;
+        }
+        return progress;
+    }
+
+    void
+    Solver::search(const size_t variable, size_t& nodes)
+    {
+        if (++nodes > MAX_NODES) { return; }
+        if (variable == variables_.size()) {
+            ++solutions_;
+            for (size_t i = 0; i < variables_.size(); ++i) { mineSolutions_[i] += assignment_[i]; }
+            return;
+        }
+
+        const cell_type* scope = scope_.data() + variable * SURROUNDING;
+        for (int mine = 0; mine <= 1; ++mine) {
+            // Every number must keep between 0 and its remaining closed cells missing
+            bool consistent = true;
+            for (size_t i = 0; i < scopeSize_[variable]; ++i) {
+                --open_[scope[i]];
+                missing_[scope[i]] -= mine;
+                if (missing_[scope[i]] < 0 || missing_[scope[i]] > open_[scope[i]]) { consistent = false; }
+            }
+            if (consistent) {
+                assignment_[variable] = mine;
+                search(variable + 1, nodes);
+            }
+            for (size_t i = 0; i < scopeSize_[variable]; ++i) {
+                ++open_[scope[i]];
+                missing_[scope[i]] += mine;
+            }
+        }
+    }
+}
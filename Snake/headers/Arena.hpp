@@ -0,0 +1,116 @@
+#ifndef __SNAKE_ARENA_HPP__
+#define __SNAKE_ARENA_HPP__
+
+#include "../headers/Engine.hpp"
+#include "../resources/headers/Board.hpp"
+#include "../resources/headers/Random.hpp"
+#include "../resources/headers/ThreadPool.hpp"
+
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+namespace SamHovhannisyan::SnakeGame
+{
+    /// @brief Many snakes sharing one large board
+    /// @details Each cell of the board holds EMPTY, FRUIT or the owner of the snake segment on
+    ///          it, and a second grid links every segment to the next one toward its head, so
+    ///          a body is walked and moved without any per-snake container. One tick moves every
+    ///          snake across a thread pool in phases separated by barriers:
+    ///          1. every snake picks its target cell and claims it in an atomic claim grid;
+    ///             a cell claimed twice in the same tick is a head-on collision for both.
+    ///          2. every snake checks its target against the board as it was at the start of
+    ///             the tick; a segment is fatal unless it is a tail that moves away this tick
+    ///             (its snake is not about to eat).
+    ///          3. tails move and dead bodies are cleared, then heads move. Writes of a phase
+    ///             never share a cell, since each snake only writes its own segments and its
+    ///             claimed target.
+    ///          Only respawning and new fruits, which draw random cells, run on one thread. The
+    ///          last phase records the snakes that died or ate, so that serial work is
+    ///          proportional to the events of the tick rather than to the board or the snake
+    ///          count. Dead snakes respawn as one cell on a random empty spot, and the
+    ///          number of fruits on the board is kept constant.
+    class Arena
+    {
+    public:
+        typedef uint32_t cell_type;
+        typedef Board::Board<cell_type> board_type;
+
+        /// @brief Board cell values; snake i is stored as FIRST_SNAKE + i
+        static constexpr cell_type EMPTY = 0;
+        static constexpr cell_type FRUIT = 1;
+        static constexpr cell_type FIRST_SNAKE = 2;
+
+    public:
+        /// @brief Constructor
+        /// @details threads = 0 uses one thread per hardware core. Throws std::invalid_argument
+        ///          if the snakes and the fruits do not fit on the board.
+        Arena(const size_t width, const size_t height, const size_t snakes, const size_t fruits,
+              const size_t threads = 0, const uint64_t seed = 1);
+
+        /// @brief Advance every snake by one tick
+        /// @param actions One direction per snake, applied like Engine::turn; nullptr keeps going
+        void step(const Engine::Direction* actions = nullptr);
+        /// @brief Scripted players: eat an adjacent fruit, otherwise mostly go straight, never
+        ///        into a wall or a body when there is a way out
+        void suggest(Engine::Direction* actions);
+
+        const board_type& getBoard() const { return board_; }
+        size_t size() const { return head_.size(); }
+        size_t getTick() const { return tick_; }
+        /// @brief Deaths since construction, head-on collisions counting both snakes
+        size_t getDeaths() const { return deaths_; }
+        size_t getFruits() const { return fruits_; }
+
+        bool isSnake(const cell_type value) const { return value >= FIRST_SNAKE; }
+        Coordinate::Coordinate getHead(const size_t snake) const { return board_.coordinateOf(head_[snake]); }
+        size_t getLength(const size_t snake) const { return length_[snake]; }
+        size_t getScore(const size_t snake) const { return score_[snake]; }
+        Engine::Direction getDirection(const size_t snake) const { return Engine::Direction(direction_[snake]); }
+
+    private:
+        /// @brief The cell one step from cell in direction, or NONE past the border
+        cell_type neighbour(const cell_type cell, const uint8_t direction) const;
+        void spawn(const size_t snake);
+        void placeFruit();
+        cell_type randomEmptyCell();
+
+        /// @brief The phases of a tick, over the snakes begin .. end; cells is the board's storage
+        void chooseTargets(const Engine::Direction* actions, const cell_type* cells, const size_t begin, const size_t end);
+        void resolveCollisions(const cell_type* cells, const size_t begin, const size_t end);
+        void moveTails(cell_type* cells, const size_t begin, const size_t end);
+        void moveHeads(cell_type* cells, const size_t begin, const size_t end);
+
+    private:
+        static constexpr cell_type NONE = cell_type(-1);
+
+        board_type board_;
+        /// @brief For every body cell, the next segment toward the head
+        std::vector<cell_type> link_;
+        /// @brief Tick and snake of the last claim of every cell
+        std::unique_ptr<std::atomic<uint64_t>[]> claims_;
+
+        std::vector<cell_type> head_;
+        std::vector<cell_type> tail_;
+        std::vector<cell_type> length_;
+        std::vector<cell_type> target_;
+        std::vector<uint32_t> score_;
+        std::vector<uint8_t> direction_;
+        std::vector<uint8_t> growing_;
+        std::vector<uint8_t> dead_;
+        /// @brief Set by whichever snake finds the head-on collision, hence atomic
+        std::unique_ptr<std::atomic<uint8_t>[]> headOn_;
+        /// @brief The snakes that died or ate this tick, in the order the threads found them
+        std::vector<cell_type> events_;
+        std::atomic<size_t> eventCount_;
+
+        size_t fruits_;
+        size_t deaths_;
+        uint64_t tick_;
+        Random::SplitMix64 random_;
+        ThreadPool::ThreadPool pool_;
+    };
+}
+
+#endif // __SNAKE_ARENA_HPP__
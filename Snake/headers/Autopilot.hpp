@@ -0,0 +1,85 @@
+#ifndef __SNAKE_AUTOPILOT_HPP__
+#define __SNAKE_AUTOPILOT_HPP__
+
+#include "../headers/Engine.hpp"
+
+#include <cstdint>
+#include <vector>
+
+namespace SamHovhannisyan::SnakeGame
+{
+    /// @brief Computer player for the snake engine
+    /// @details PATHFINDING runs a breadth-first search to the fruit and only takes its first
+    ///          step if the tail is still reachable afterwards; otherwise it follows the tail,
+    ///          preferring the Hamiltonian cycle successor, and as a last resort picks the move
+    ///          with the most room. After sixteen board-sized rounds without eating it takes the
+    ///          path to the fruit even when that is unsafe, so a game near a full board ends
+    ///          instead of circling forever. The path is reused until the fruit moves, since the
+    ///          body only ever trails the head along it. HAMILTONIAN walks a Hamiltonian cycle of
+    ///          the board and takes shortcuts toward the fruit that never overtake the tail in
+    ///          cycle order, which keeps the body laid along the cycle and guarantees the board
+    ///          gets filled. A cycle exists when the board has an even side; otherwise
+    ///          HAMILTONIAN falls back to PATHFINDING. All search buffers are sized once, so
+    ///          decide() never allocates.
+    class Autopilot
+    {
+    public:
+        enum Strategy
+        {
+            PATHFINDING,
+            HAMILTONIAN
+        };
+
+    public:
+        /// @brief Constructor
+        /// @details Sizes the cycle and the search buffers for the board of engine; the
+        ///          autopilot can then drive any engine with a board of that shape.
+        Autopilot(const Engine& engine, const Strategy strategy = HAMILTONIAN);
+
+        /// @brief Pick the direction for the next tick of engine
+        Engine::Direction decide(const Engine& engine);
+
+        Strategy getStrategy() const { return strategy_; }
+        bool hasCycle() const { return !cycleOrder_.empty(); }
+
+    private:
+        typedef uint32_t cell_type;
+
+        void buildCycle();
+        size_t decideCycle(const Engine& engine, const size_t head);
+        size_t decidePath(const Engine& engine, const size_t head);
+        size_t neighbours(const Engine& engine, const size_t cell, const bool firstStep, size_t* out) const;
+        bool isPassable(const Engine& engine, const size_t cell) const;
+        /// @brief Breadth-first search from one cell to another, leaving the path in parent_
+        /// @param fromHead Whether from is the head, which cannot step back onto its neck
+        bool search(const Engine& engine, const size_t from, const size_t target, const size_t blocked,
+                    const bool fromHead = false);
+        size_t room(const Engine& engine, const size_t from, const size_t blocked);
+        size_t cycleDistance(const size_t from, const size_t to) const;
+        Engine::Direction directionTo(const size_t head, const size_t cell) const;
+
+    private:
+        size_t cols_;
+        size_t rows_;
+        Strategy strategy_;
+        /// @brief Cells in cycle order, and the position of every cell in that order
+        std::vector<cell_type> cycleOrder_;
+        std::vector<cell_type> cyclePosition_;
+        /// @brief Search state reused by every call; a cell is visited when its stamp is current
+        std::vector<cell_type> visited_;
+        std::vector<cell_type> parent_;
+        std::vector<cell_type> queue_;
+        cell_type stamp_;
+        /// @brief Remaining steps of the last path to the fruit, next step last
+        std::vector<cell_type> path_;
+        size_t pathFruit_;
+        /// @brief Cells of the current tail and whether it moves away on the next tick
+        size_t tail_;
+        bool tailMoves_;
+        /// @brief Decisions since the snake last grew, to break out of tail-following loops
+        size_t length_;
+        size_t idle_;
+    };
+}
+
+#endif // __SNAKE_AUTOPILOT_HPP__
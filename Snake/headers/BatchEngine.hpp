@@ -0,0 +1,103 @@
+#ifndef __SNAKE_BATCH_ENGINE_HPP__
+#define __SNAKE_BATCH_ENGINE_HPP__
+
+#include "../headers/Engine.hpp"
+#include "../resources/headers/Random.hpp"
+#include "../resources/headers/ThreadPool.hpp"
+
+#include <cstdint>
+#include <vector>
+
+namespace SamHovhannisyan::SnakeGame
+{
+    /// @brief Many snake games stepped together, for bots and simulations
+    /// @details Runs the Engine rules (wall and self collision, the tail cell freed on the same
+    ///          tick, growing on the fruit, a full board ending the game) on a fixed number of
+    ///          same-sized games stored as structure of arrays: one entry per game for the head,
+    ///          direction, length and fruit, one ring of cell indices per game for the body and
+    ///          one occupancy bit-plane per game for collisions and fruit placement. step()
+    ///          advances every game by one tick across a thread pool; a game that ends is reset
+    ///          on the spot, with its final reward and done flag reported for that step. Every
+    ///          game has its own random stream, so results do not depend on the thread count.
+    ///          Observations are one byte per cell (Engine::BoardElements), game after game in
+    ///          a single buffer, and are updated in place by the cells each tick touches.
+    class BatchEngine
+    {
+    public:
+        typedef uint32_t cell_type;
+        typedef uint64_t word_type;
+
+        /// @brief Reward of a step: the fruit was eaten, or the snake died
+        static constexpr int8_t REWARD_FRUIT = 1;
+        static constexpr int8_t REWARD_DEATH = -1;
+
+    public:
+        /// @brief Constructor
+        /// @details threads = 0 uses one thread per hardware core.
+        BatchEngine(const size_t games, const size_t width = 20, const size_t height = 20,
+                    const size_t threads = 0, const uint64_t seed = 1);
+
+        /// @brief Start every game over
+        void reset();
+        /// @brief Advance every game by one tick
+        /// @param actions One direction per game, applied like Engine::turn; nullptr keeps going
+        void step(const Engine::Direction* actions = nullptr);
+
+        size_t size() const { return games_; }
+        size_t getCols() const { return cols_; }
+        size_t getRows() const { return rows_; }
+        size_t getCells() const { return cells_; }
+
+        /// @brief size() * getCells() cells, game after game, row-major within a game
+        const uint8_t* getObservations() const { return observations_.data(); }
+        const uint8_t* getObservation(const size_t game) const { return observations_.data() + game * cells_; }
+        /// @brief Per game outcome of the last step
+        const int8_t* getRewards() const { return rewards_.data(); }
+        const uint8_t* getDone() const { return done_.data(); }
+
+        size_t getLength(const size_t game) const { return length_[game]; }
+        /// @brief Games finished since construction, and the sum of their scores
+        size_t getEpisodes() const;
+        size_t getTotalScore() const;
+
+    private:
+        void resetGame(const size_t game);
+        void stepGame(const size_t game, const Engine::Direction action);
+        void finishGame(const size_t game, const int8_t reward);
+        void placeFruit(const size_t game);
+
+        bool isOccupied(const size_t game, const cell_type cell) const
+        {
+            return (occupancy_[game * words_ + cell / 64] >> (cell % 64)) & 1;
+        }
+
+    private:
+        size_t games_;
+        size_t cols_;
+        size_t rows_;
+        size_t cells_;
+        /// @brief 64-bit words in the occupancy bit-plane of one game
+        size_t words_;
+
+        std::vector<cell_type> head_;
+        std::vector<cell_type> fruit_;
+        std::vector<cell_type> length_;
+        /// @brief Ring slot of the head in the body ring of each game
+        std::vector<cell_type> bodyStart_;
+        std::vector<uint8_t> direction_;
+        std::vector<Random::SplitMix64> random_;
+        std::vector<uint32_t> episodes_;
+        std::vector<uint64_t> totalScore_;
+
+        /// @brief cells_ body slots per game, head at bodyStart_ and the tail length_ - 1 after it
+        std::vector<cell_type> body_;
+        std::vector<word_type> occupancy_;
+        std::vector<uint8_t> observations_;
+        std::vector<int8_t> rewards_;
+        std::vector<uint8_t> done_;
+
+        ThreadPool::ThreadPool pool_;
+    };
+}
+
+#endif // __SNAKE_BATCH_ENGINE_HPP__
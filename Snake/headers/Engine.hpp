@@ -0,0 +1,111 @@
+#ifndef __SNAKE_ENGINE_HPP__
+#define __SNAKE_ENGINE_HPP__
+
+#include "../resources/headers/Board.hpp"
+#include "../resources/headers/Random.hpp"
+#include "../resources/headers/RingBuffer.hpp"
+#include "../resources/headers/Snapshot.hpp"
+#include "../resources/headers/SparseSet.hpp"
+#include "../headers/Fruit.hpp"
+
+#include <string>
+
+namespace SamHovhannisyan::SnakeGame
+{
+    /// @brief Headless snake rules
+    /// @details Owns the whole game state and knows nothing about the terminal: the caller
+    ///          turns the snake, advances it one tick at a time and reads the state back.
+    ///          The ncurses front-end and the benchmarks both drive the game through this class.
+    ///          The board is the authoritative occupancy grid and the body is a ring buffer
+    ///          sized for a snake filling the whole board, so moving and self-collision are O(1)
+    ///          at any length. The free cells are kept in an indexed set as the snake moves, so
+    ///          a new fruit is one uniform sample. All randomness comes from a generator seeded
+    ///          per game, so a game is reproducible from its seed and the turns taken.
+    class Engine
+    {
+    public:
+        enum Direction
+        {
+            UP = 8,
+            DOWN = 2,
+            LEFT = 4,
+            RIGHT = 6
+        };
+
+        enum BoardElements
+        {
+            EMPTY = 0,
+            SNAKE_HEAD = 1,
+            SNAKE_BODY = 2,
+            FRUIT = 3
+        };
+
+        typedef Coordinate::Coordinate Coordinate;
+        typedef Board::Board<BoardElements> board_type;
+        /// @brief Body segments, head first
+        typedef RingBuffer::RingBuffer<Coordinate> body_type;
+
+        static const uint32_t SNAPSHOT_KIND;
+
+    public:
+        Engine(const size_t width = 20, const size_t height = 20, const uint64_t seed = Random::randomSeed());
+
+        /// @brief Start a new game on a board of the same size, seeded from the previous game
+        void reset();
+        /// @brief Start a new game with the given seed
+        void reset(const uint64_t seed);
+        /// @brief Queue a turn for the next tick; reversing onto the body is ignored
+        void turn(const Direction newDirection);
+        /// @brief Advance the game by one tick
+        /// @return false once the game is over
+        bool step();
+
+        bool isGameOver() const { return game_over_; }
+        const board_type& getBoard() const { return board_; }
+        const Coordinate& getHead() const { return snakeHead_; }
+        const body_type& getBody() const { return snakeBody_; }
+        const Coordinate& getFruit() const { return fruit_.coordinate; }
+        Direction getDirection() const { return direction_; }
+        size_t getScore() const { return snakeBody_.size() - 1; }
+        size_t getLevel() const { return level_; }
+        /// @brief Delay between ticks at the current level, in microseconds
+        size_t getSpeed() const { return speed_; }
+        /// @brief The seed the current game was started with
+        uint64_t getSeed() const { return seed_; }
+
+        /// @brief Dirty cell tracking of the board, for incremental renderers
+        void setDirtyTracking(const bool enabled) { board_.setDirtyTracking(enabled); }
+        void clearDirty() { board_.clearDirty(); }
+
+        void save(const std::string& path) const;
+        void load(const std::string& path);
+        Snapshot::StateWriter saveState() const;
+        /// @brief Restore a state written by saveState() on a board of the same size
+        /// @details The board is rebuilt from the snake and the fruit.
+        void restoreState(const std::string& state);
+
+    private:
+        void moveSnake();
+        void placeFruit();
+        void eatFruit();
+        void readState(Snapshot::StateReader& state);
+
+    private:
+        board_type board_;
+        Fruit::Fruit fruit_;
+        Coordinate snakeHead_;
+        body_type snakeBody_;
+        /// @brief Indices of the EMPTY cells of board_
+        SparseSet::SparseSet freeCells_;
+        Direction direction_;
+        size_t level_;
+        size_t speed_;
+        bool game_over_;
+        /// @brief Fruits placed this game; every third one raises the level
+        size_t fruitCount_;
+        uint64_t seed_;
+        Random::SplitMix64 random_;
+    };
+}
+
+#endif // __SNAKE_ENGINE_HPP__
@@ -9,7 +9,6 @@ namespace SamHovhannisyan::Fruit
     struct Fruit
     {
         typedef Coordinate::Coordinate::coordinate_type coordinate_type;
-        static size_t FRUIT_COUNT;
         Coordinate::Coordinate coordinate;
         Fruit(const Coordinate::Coordinate& coord = Coordinate::Coordinate()) : coordinate(coord) {}
         Fruit(const coordinate_type x, const coordinate_type y) : coordinate(Coordinate::Coordinate(x, y)) {}
@@ -18,8 +17,6 @@ namespace SamHovhannisyan::Fruit
         bool operator==(const Fruit& rhv) const { return coordinate == rhv.coordinate; }
         bool operator!=(const Fruit& rhv) const { return !(*this == rhv); }
     };
-
-    inline size_t Fruit::FRUIT_COUNT = 0;
 }    
 
 #endif // __FRUIT_HPP__
@@ -1,13 +1,20 @@
 #ifndef __SNAKE_HPP__
 #define __SNAKE_HPP__
 
-#include "../resources/headers/Board.hpp"
-#include "../headers/Fruit.hpp"
+#include "../headers/Autopilot.hpp"
+#include "../headers/Engine.hpp"
+#include "../headers/Input.hpp"
+#include "../headers/Replay.hpp"
+#include "../resources/headers/Histogram.hpp"
+#include "../resources/headers/Scheduler.hpp"
+#include "../resources/headers/Viewport.hpp"
 
 #include <ncurses.h>
 #include <unistd.h>
 #include <ctime>
 #include <cstdlib>
+#include <memory>
+#include <string>
 
 namespace SamHovhannisyan::SnakeGame
 {
@@ -16,44 +23,47 @@ namespace SamHovhannisyan::SnakeGame
     public:
         Snake(const size_t width = 20, const size_t height = 20);
         void start();
+        void save(const std::string& path) const;
+        void load(const std::string& path);
+        void setCheckpoint(const std::string& path);
+        /// @brief Let the computer steer; arrow keys are ignored from then on
+        void setAutopilot(const Autopilot::Strategy strategy);
+        /// @brief Start the game over with a fixed seed, so it can be played again
+        void setSeed(const uint64_t seed);
+        /// @brief Write a replay of the game to path when it ends
+        void setRecording(const std::string& path);
+        /// @brief Play a replay file back: space pauses, arrows seek, +/- change the speed, q quits
+        void watch(const std::string& path);
     
     private:
-        enum Direction
-        {
-            UP = 8,
-            DOWN = 2,
-            LEFT = 4,
-            RIGHT = 6
-        };
-
-        enum BoardElements
-        {
-            EMPTY = 0,
-            SNAKE_HEAD = 1,
-            SNAKE_BODY = 2,
-            FRUIT = 3
-        };
-
-    private:
-        void drawBoard() const;
-        void moveSnake();
-        void placeFruit();
-        void eatFruit();
-        void changeDirection(Direction newDirection);
-        void checkCollision();
+        void openScreen();
+        void drawBoard();
+        /// @brief Pick up a terminal resize and keep the head in view
+        /// @return Whether the visible window changed, so it has to be drawn from scratch
+        bool layout();
+        void drawCell(const Coordinate::Coordinate& pos) const;
         void initializeColors();
-        void handleInput();
+        /// @brief Apply the next queued turn
+        /// @return When the applied key was pressed, 0 if no turn was applied
+        int64_t handleInput();
         void renderGameOver() const;
     
     private:
-        Board::Board<BoardElements> board_;
-        Fruit::Fruit fruit_;
-        Coordinate::Coordinate snakeHead_;
-        std::vector<Coordinate::Coordinate> snakeBody_;
-        Direction direction_;
-        size_t level_;
-        size_t speed_;
-        bool game_over_;
+        Engine engine_;
+        Scheduler::Scheduler scheduler_;
+        std::string checkpoint_;
+        Snapshot::Writer writer_;
+        size_t ticks_;
+        std::unique_ptr<Autopilot> autopilot_;
+        std::string recording_;
+        Replay replay_;
+        Input input_;
+        /// @brief Nanoseconds from a key press to the tick that moved the snake in its direction
+        Histogram::Histogram latency_;
+        Viewport::Viewport viewport_;
+        /// @brief The terminal size the viewport was last fitted to
+        int lines_;
+        int cols_;
     };
 }    
 
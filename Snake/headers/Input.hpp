@@ -0,0 +1,63 @@
+#ifndef __SNAKE_INPUT_HPP__
+#define __SNAKE_INPUT_HPP__
+
+#include "../headers/Engine.hpp"
+#include "../resources/headers/SpscQueue.hpp"
+
+#include <atomic>
+#include <cstdint>
+#include <string>
+#include <thread>
+
+namespace SamHovhannisyan::SnakeGame
+{
+    /// @brief An arrow key press and when it was read, on the Scheduler::now() clock
+    struct KeyPress
+    {
+        Engine::Direction direction;
+        int64_t time;
+    };
+
+    /// @brief Keyboard reader on its own thread
+    /// @details Reads the terminal file descriptor directly as soon as bytes arrive, decodes the
+    ///          arrow key escape sequences (both the normal and the keypad transmit forms) and
+    ///          pushes timestamped presses into a lock-free queue that the game loop drains at
+    ///          its own pace. ncurses is not thread safe, so while the reader runs the game must
+    ///          not call getch(). Presses are dropped, and counted, only if the queue is full.
+    class Input
+    {
+    public:
+        typedef SpscQueue::SpscQueue<KeyPress, 64> queue_type;
+
+    public:
+        Input();
+        ~Input();
+        Input(const Input& rhv) = delete;
+        const Input& operator=(const Input& rhv) = delete;
+
+        void start(const int fd = 0);
+        void stop();
+
+        /// @brief Consumer side: the oldest press not handled yet
+        bool pop(KeyPress& press) { return queue_.pop(press); }
+        size_t getDropped() const { return dropped_; }
+
+        /// @brief Decode the arrow keys at the front of bytes
+        /// @return The number of bytes consumed, 0 if more bytes are needed to decide
+        static size_t decode(const char* bytes, const size_t size, Engine::Direction& direction, bool& isArrow);
+
+    private:
+        void run();
+
+    private:
+        queue_type queue_;
+        std::thread thread_;
+        std::atomic<bool> running_;
+        std::atomic<size_t> dropped_;
+        int fd_;
+        /// @brief Bytes of an escape sequence split across reads
+        std::string pending_;
+    };
+}
+
+#endif // __SNAKE_INPUT_HPP__
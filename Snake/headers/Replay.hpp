@@ -0,0 +1,76 @@
+#ifndef __SNAKE_REPLAY_HPP__
+#define __SNAKE_REPLAY_HPP__
+
+#include "../headers/Engine.hpp"
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace SamHovhannisyan::SnakeGame
+{
+    /// @brief Recording of one snake game that can be played back from any tick
+    /// @details A game is fully determined by its seed and the direction the snake moved in on
+    ///          every tick, so only the ticks where the direction changed are stored. A keyframe
+    ///          with the whole engine state (Engine::saveState) is kept every keyframe interval,
+    ///          so seek() restores the last keyframe at or before the tick and steps forward
+    ///          from there: at most one interval of ticks, whatever the length of the game.
+    ///          On disk the changes are delta-encoded varints (ticks since the previous change,
+    ///          times four, plus the direction), followed by the keyframes.
+    class Replay
+    {
+    public:
+        static const uint32_t REPLAY_KIND;
+        static constexpr uint32_t VERSION = 1;
+        static constexpr size_t DEFAULT_KEYFRAME_TICKS = 256;
+
+    public:
+        Replay(const size_t keyframeTicks = DEFAULT_KEYFRAME_TICKS);
+
+        /// @brief Start recording the game the engine is about to play
+        void begin(const Engine& engine);
+        /// @brief Record the tick the engine just stepped
+        void record(const Engine& engine);
+
+        /// @brief Ticks recorded
+        size_t getTicks() const { return ticks_; }
+        size_t getKeyframeTicks() const { return keyframeTicks_; }
+        uint64_t getSeed() const { return seed_; }
+        size_t getRows() const { return rows_; }
+        size_t getCols() const { return cols_; }
+        size_t getChanges() const { return changes_.size(); }
+
+        /// @brief Put the engine in the state after the given number of ticks
+        /// @details The engine must have the board size of the recording. Ticks past the end
+        ///          of the recording are clamped to it.
+        void seek(Engine& engine, const size_t tick) const;
+        /// @brief The direction the snake moved in on the given tick
+        Engine::Direction getDirection(const size_t tick) const;
+
+        /// @brief Throws std::runtime_error on I/O failure or a malformed file
+        void save(const std::string& path) const;
+        void load(const std::string& path);
+
+    private:
+        struct Change
+        {
+            uint64_t tick;
+            Engine::Direction direction;
+        };
+
+    private:
+        size_t keyframeTicks_;
+        size_t rows_;
+        size_t cols_;
+        uint64_t seed_;
+        size_t ticks_;
+        /// @brief Direction of the tick before, to detect changes while recording
+        Engine::Direction last_;
+        /// @brief Direction changes in tick order; the first tick always has one
+        std::vector<Change> changes_;
+        /// @brief keyframes_[i] is the engine state after i * keyframeTicks_ ticks
+        std::vector<std::string> keyframes_;
+    };
+}
+
+#endif // __SNAKE_REPLAY_HPP__
@@ -1,9 +1,46 @@
 #include "./headers/Game.hpp"
 
+#include <cstdlib>
+#include <cstring>
+#include <iostream>
+
 int
-main()
+main(int argc, char** argv)
 {
     SamHovhannisyan::SnakeGame::Snake game(20, 20);
+
+    // --replay <file>: watch a recorded game instead of playing
+    for (int i = 1; i + 1 < argc; ++i) {
+        if (std::strcmp(argv[i], "--replay") != 0) { continue; }
+        try { game.watch(argv[i + 1]); }
+        catch (const std::exception& e) { endwin(); std::cerr << e.what() << std::endl; return 1; }
+        return 0;
+    }
+
+    // --seed <n>: play the game that seed deals; --record <file>: write a replay when it ends
+    for (int i = 1; i + 1 < argc; ++i) {
+        if (std::strcmp(argv[i], "--seed") == 0)   { game.setSeed(std::strtoull(argv[i + 1], nullptr, 10)); }
+        if (std::strcmp(argv[i], "--record") == 0) { game.setRecording(argv[i + 1]); }
+    }
+
+    // --checkpoint <file>: resume from the file if it exists and keep saving to it
+    for (int i = 1; i + 1 < argc; ++i) {
+        if (std::strcmp(argv[i], "--checkpoint") != 0) { continue; }
+        if (access(argv[i + 1], F_OK) == 0) {
+            try { game.load(argv[i + 1]); }
+            catch (const std::exception& e) { std::cerr << e.what() << std::endl; return 1; }
+        }
+        game.setCheckpoint(argv[i + 1]);
+    }
+
+    // --autopilot [bfs|cycle]: let the computer play, following the Hamiltonian cycle by default
+    for (int i = 1; i < argc; ++i) {
+        if (std::strcmp(argv[i], "--autopilot") != 0) { continue; }
+        const bool bfs = i + 1 < argc && std::strcmp(argv[i + 1], "bfs") == 0;
+        game.setAutopilot(bfs ? SamHovhannisyan::SnakeGame::Autopilot::PATHFINDING
+                              : SamHovhannisyan::SnakeGame::Autopilot::HAMILTONIAN);
+    }
+
     game.start();
     
     return 0;
@@ -0,0 +1,165 @@
+#include "headers/Arena.hpp"
+#include "headers/Autopilot.hpp"
+#include "headers/BatchEngine.hpp"
+#include "headers/Replay.hpp"
+#include "headers/Engine.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <vector>
+
+namespace
+{
+    typedef std::chrono::steady_clock clock_type;
+    typedef SamHovhannisyan::SnakeGame::Engine Engine;
+    typedef SamHovhannisyan::SnakeGame::Arena Arena;
+    typedef SamHovhannisyan::SnakeGame::Autopilot Autopilot;
+    typedef SamHovhannisyan::SnakeGame::BatchEngine BatchEngine;
+    typedef SamHovhannisyan::SnakeGame::Replay Replay;
+
+    const Engine::Direction DIRECTIONS[4] = { Engine::UP, Engine::DOWN, Engine::LEFT, Engine::RIGHT };
+}
+
+/// Autopilot decisions per second and the scores they reach, within a decision budget per board
+void
+benchAutopilot(const Autopilot::Strategy strategy, const char* name)
+{
+    const size_t SIDES[3] = { 20, 100, 1000 };
+    const size_t DECISIONS[3] = { 200000, 50000, 20000 };
+
+    for (size_t i = 0; i < 3; ++i) {
+        Engine engine(SIDES[i], SIDES[i], 1);
+        Autopilot autopilot(engine, strategy);
+        size_t games = 1;
+        size_t totalScore = 0;
+
+        const clock_type::time_point start = clock_type::now();
+        for (size_t decision = 0; decision < DECISIONS[i]; ++decision) {
+            engine.turn(autopilot.decide(engine));
+            if (!engine.step()) {
+                totalScore += engine.getScore();
+                engine.reset();
+                ++games;
+            }
+        }
+        const std::chrono::duration<double> elapsed = clock_type::now() - start;
+
+        // The game still running at the end of the budget counts with its current score
+        totalScore += engine.getScore();
+        std::printf("%-6s %5zux%-4zu %10zu %8zu %10.1f %12.0f\n", name, SIDES[i], SIDES[i], DECISIONS[i],
+                    games, double(totalScore) / games, DECISIONS[i] / elapsed.count());
+    }
+}
+
+/// Batched games per second: every game gets a random action each tick
+void
+benchBatch(const size_t games, const size_t side)
+{
+    const size_t TICKS = 2000;
+    BatchEngine batch(games, side, side);
+    std::vector<Engine::Direction> actions(games);
+
+    double seconds = 0;
+    for (size_t tick = 0; tick < TICKS; ++tick) {
+        for (Engine::Direction& action : actions) { action = DIRECTIONS[std::rand() % 4]; }
+        const clock_type::time_point start = clock_type::now();
+        batch.step(actions.data());
+        seconds += std::chrono::duration<double>(clock_type::now() - start).count();
+    }
+
+    const double episodes = batch.getEpisodes();
+    std::printf("%8zu %5zux%-4zu %8zu %10.0f %10.2f %12.0f\n", games, side, side, TICKS, episodes,
+                batch.getTotalScore() / episodes, games * TICKS / seconds);
+}
+
+/// Replay seeking: a whole autopilot game is recorded, then random ticks are sought
+void
+benchReplay()
+{
+    const size_t SEEKS = 10000;
+    Engine engine(20, 20, 1);
+    Autopilot autopilot(engine);
+    Replay replay;
+    replay.begin(engine);
+    while (!engine.isGameOver()) {
+        engine.turn(autopilot.decide(engine));
+        engine.step();
+        replay.record(engine);
+    }
+
+    const clock_type::time_point start = clock_type::now();
+    for (size_t seek = 0; seek < SEEKS; ++seek) { replay.seek(engine, std::rand() % (replay.getTicks() + 1)); }
+    const std::chrono::duration<double> elapsed = clock_type::now() - start;
+
+    std::printf("%8zu %10zu %10zu %10zu %12.0f\n", replay.getTicks(), replay.getChanges(),
+                replay.getKeyframeTicks(), SEEKS, SEEKS / elapsed.count());
+}
+
+/// Arena ticks on a shared 1000x1000 board with scripted snakes, against a 60 Hz frame budget
+void
+benchArena(const size_t snakes)
+{
+    const size_t SIDE = 1000;
+    const size_t TICKS = 200;
+    const double BUDGET_US = 16667;
+    Arena arena(SIDE, SIDE, snakes, snakes);
+    std::vector<Engine::Direction> actions(snakes);
+
+    double total = 0;
+    double worst = 0;
+    size_t length = 0;
+    for (size_t tick = 0; tick < TICKS; ++tick) {
+        const clock_type::time_point start = clock_type::now();
+        arena.suggest(actions.data());
+        arena.step(actions.data());
+        const double elapsed = std::chrono::duration<double, std::micro>(clock_type::now() - start).count();
+        total += elapsed;
+        worst = std::max(worst, elapsed);
+    }
+    for (size_t snake = 0; snake < snakes; ++snake) { length += arena.getLength(snake); }
+
+    std::printf("%8zu %8zu %10.1f %10.1f %10.2f %10.1f %7s\n", snakes, TICKS, total / TICKS, worst,
+                double(arena.getDeaths()) / TICKS, double(length) / snakes, worst <= BUDGET_US ? "yes" : "no");
+}
+
+/// Headless throughput of the snake rules: random turns, no terminal, no sleeping
+int
+main()
+{
+    const size_t STEPS = 2000000;
+    std::srand(1);
+
+    std::printf("%8s %12s %10s %12s\n", "board", "steps", "games", "steps/s");
+    for (const size_t side : { 10, 20, 40 }) {
+        Engine engine(side, side, 1);
+        size_t games = 1;
+
+        const clock_type::time_point start = clock_type::now();
+        for (size_t step = 0; step < STEPS; ++step) {
+            if (std::rand() % 8 == 0) { engine.turn(DIRECTIONS[std::rand() % 4]); }
+            if (!engine.step()) { engine.reset(); ++games; }
+        }
+        const std::chrono::duration<double> elapsed = clock_type::now() - start;
+
+        std::printf("%5zux%-3zu %12zu %10zu %12.0f\n", side, side, STEPS, games, STEPS / elapsed.count());
+    }
+
+    std::printf("\n%-6s %10s %10s %8s %10s %12s\n", "pilot", "board", "decisions", "games", "avg score", "decisions/s");
+    benchAutopilot(Autopilot::PATHFINDING, "bfs");
+    benchAutopilot(Autopilot::HAMILTONIAN, "cycle");
+
+    std::printf("\n%8s %10s %8s %10s %10s %12s\n", "games", "board", "ticks", "episodes", "avg score", "steps/s");
+    benchBatch(1024, 20);
+    benchBatch(4096, 20);
+    benchBatch(256, 100);
+
+    std::printf("\n%8s %10s %10s %10s %12s\n", "ticks", "changes", "keyframe", "seeks", "seeks/s");
+    benchReplay();
+
+    std::printf("\n%8s %8s %10s %10s %10s %10s %7s\n", "snakes", "ticks", "mean us", "worst us", "deaths/t", "avg len", "budget");
+    for (const size_t snakes : { 100, 1000, 10000, 100000 }) { benchArena(snakes); }
+
+    return 0;
+}
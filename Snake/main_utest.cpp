@@ -0,0 +1,85 @@
+#include "headers/Engine.hpp"
+#include "headers/Autopilot.hpp"
+#include <gtest/gtest.h>
+#include <algorithm>
+#include <string>
+#include <vector>
+
+namespace
+{
+    typedef SamHovhannisyan::SnakeGame::Engine Engine;
+    typedef SamHovhannisyan::SnakeGame::Autopilot Autopilot;
+
+    /// The state of a game with the given snake, head first, and fruit; every other cell is free
+    std::string
+    position(const Engine& engine, const std::vector<Engine::Coordinate>& body, const Engine::Coordinate& fruit,
+             const Engine::Direction direction)
+    {
+        const Engine::board_type& board = engine.getBoard();
+        std::vector<bool> taken(board.size(), false);
+        taken[board.indexOf(fruit)] = true;
+
+        SamHovhannisyan::Snapshot::StateWriter state;
+        state.put<uint64_t>(fruit.x);
+        state.put<uint64_t>(fruit.y);
+        state.put<uint64_t>(body.front().x);
+        state.put<uint64_t>(body.front().y);
+        state.put<uint64_t>(body.size());
+        for (const Engine::Coordinate& segment : body) {
+            state.put<uint64_t>(segment.x);
+            state.put<uint64_t>(segment.y);
+            taken[board.indexOf(segment)] = true;
+        }
+        state.put(direction);
+        state.put<uint64_t>(1);
+        state.put<uint64_t>(200000);
+        state.put(false);
+        state.put<uint64_t>(1);
+        state.put<uint64_t>(engine.getSeed());
+        state.put<uint64_t>(engine.getSeed());
+        state.put<uint64_t>(std::count(taken.begin(), taken.end(), false));
+        for (size_t index = 0; index < board.size(); ++index) {
+            if (!taken[index]) { state.put<uint32_t>(index); }
+        }
+        return state.bytes();
+    }
+}
+
+TEST(AutopilotTest, FruitBehindTheHead)
+{
+    // The engine ignores a turn back onto the neck, so the way to a fruit straight behind a
+    // one-cell snake has to go around
+    for (const Autopilot::Strategy strategy : { Autopilot::PATHFINDING, Autopilot::HAMILTONIAN }) {
+        Engine engine(8, 8, 1);
+        engine.restoreState(position(engine, { Engine::Coordinate(4, 4) }, Engine::Coordinate(3, 4), Engine::RIGHT));
+        Autopilot autopilot(engine, strategy);
+
+        for (size_t tick = 0; tick < 64 && engine.getBody().size() == 1; ++tick) {
+            engine.turn(autopilot.decide(engine));
+            ASSERT_TRUE(engine.step());
+        }
+        EXPECT_EQ(engine.getBody().size(), 2);
+    }
+}
+
+TEST(AutopilotTest, PathfindingGamesEnd)
+{
+    // These games used to settle into a tail-chasing loop a few cells short of a full board
+    for (const uint64_t seed : { 1, 2, 4 }) {
+        Engine engine(20, 20, seed);
+        Autopilot autopilot(engine, Autopilot::PATHFINDING);
+        for (size_t tick = 0; tick < 500000 && !engine.isGameOver(); ++tick) {
+            engine.turn(autopilot.decide(engine));
+            engine.step();
+        }
+        EXPECT_TRUE(engine.isGameOver());
+        EXPECT_GT(engine.getBody().size(), 350);
+    }
+}
+
+int
+main(int argc, char **argv)
+{
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
@@ -0,0 +1,270 @@
+#include "headers/Arena.hpp"
+
+#include <algorithm>
+#include <stdexcept>
+#include <utility>
+
+namespace SamHovhannisyan::SnakeGame
+{
+    namespace
+    {
+        const uint8_t DIRECTIONS[4] = { Engine::UP, Engine::DOWN, Engine::LEFT, Engine::RIGHT };
+        /// Random picks tried before scanning for an empty cell
+        const size_t SPAWN_TRIES = 64;
+        /// One scripted turn in this many ticks even when straight ahead is free
+        const uint64_t WANDER = 16;
+        /// States of dead_: killed this tick, or waiting for a free cell to respawn on
+        const uint8_t DIED = 1;
+        const uint8_t WAITING = 2;
+    }
+
+    Arena::Arena(const size_t width, const size_t height, const size_t snakes, const size_t fruits,
+                 const size_t threads, const uint64_t seed)
+        : board_(height, width)
+        , link_(width * height, NONE)
+        , claims_(new std::atomic<uint64_t>[width * height])
+        , head_(snakes)
+        , tail_(snakes)
+        , length_(snakes, 0)
+        , target_(snakes, NONE)
+        , score_(snakes, 0)
+        , direction_(snakes)
+        , growing_(snakes, 0)
+        , dead_(snakes, 0)
+        , headOn_(new std::atomic<uint8_t>[snakes])
+        , events_(snakes)
+        , eventCount_(0)
+        , fruits_(0)
+        , deaths_(0)
+        , tick_(0)
+        , random_(seed)
+        , pool_(threads)
+    {
+        if (snakes + fruits > board_.size()) { throw std::invalid_argument("Arena: too many snakes and fruits for the board"); }
+        if (uint64_t(snakes) + FIRST_SNAKE > NONE) { throw std::invalid_argument("Arena: too many snakes"); }
+
+        board_.fill(EMPTY);
+        for (size_t cell = 0; cell < board_.size(); ++cell) { claims_[cell] = 0; }
+        for (size_t snake = 0; snake < snakes; ++snake) {
+            headOn_[snake] = 0;
+            spawn(snake);
+        }
+        for (size_t i = 0; i < fruits; ++i) { placeFruit(); }
+    }
+
+    void
+    Arena::step(const Engine::Direction* actions)
+    {
+        ++tick_;
+        // Taken once here: the mutable data() marks the board dirty, which no worker may do
+        cell_type* cells = board_.data();
+        pool_.parallelFor(size(), [this, actions, cells](const size_t begin, const size_t end) { chooseTargets(actions, cells, begin, end); });
+        pool_.parallelFor(size(), [this, cells](const size_t begin, const size_t end) { resolveCollisions(cells, begin, end); });
+        pool_.parallelFor(size(), [this, cells](const size_t begin, const size_t end) { moveTails(cells, begin, end); });
+        pool_.parallelFor(size(), [this, cells](const size_t begin, const size_t end) { moveHeads(cells, begin, end); });
+
+        // Random placement is the only serial work, one call per death or eaten fruit that
+        // moveHeads recorded; snake order keeps a seeded arena the same whatever the threads
+        const size_t events = eventCount_.exchange(0, std::memory_order_relaxed);
+        std::sort(events_.begin(), events_.begin() + events);
+        for (size_t i = 0; i < events; ++i) {
+            const size_t snake = events_[i];
+            if (dead_[snake]) {
+                if (dead_[snake] == DIED) { ++deaths_; }
+                spawn(snake);
+            } else if (growing_[snake]) {
+                --fruits_;
+                placeFruit();
+            }
+        }
+    }
+
+    void
+    Arena::suggest(Engine::Direction* actions)
+    {
+        const cell_type* cells = board_.data();
+        pool_.parallelFor(size(), [this, actions, cells](const size_t begin, const size_t end) {
+            for (size_t snake = begin; snake < end; ++snake) {
+                if (length_[snake] == 0) { continue; }
+                const uint8_t forward = direction_[snake];
+                Random::SplitMix64 random(tick_ * 0x9E3779B97F4A7C15ull + snake);
+                const uint64_t roll = random();
+
+                // Straight ahead first (unless wandering), then the two sides in random order
+                uint8_t order[3] = { forward, 0, 0 };
+                size_t sides = 1;
+                for (const uint8_t direction : DIRECTIONS) {
+                    if (direction != forward && direction + forward != 10) { order[sides++] = direction; }
+                }
+                if (roll & 1) { std::swap(order[1], order[2]); }
+                if ((roll >> 1) % WANDER == 0) { std::swap(order[0], order[1]); }
+
+                uint8_t choice = forward;
+                bool safe = false;
+                for (const uint8_t direction : order) {
+                    const cell_type cell = neighbour(head_[snake], direction);
+                    if (cell == NONE) { continue; }
+                    if (cells[cell] == FRUIT) { choice = direction; break; }
+                    if (!safe && (cells[cell] == EMPTY || cell == tail_[cells[cell] - FIRST_SNAKE])) {
+                        choice = direction;
+                        safe = true;
+                    }
+                }
+                actions[snake] = Engine::Direction(choice);
+            }
+        });
+    }
+
+    Arena::cell_type
+    Arena::neighbour(const cell_type cell, const uint8_t direction) const
+    {
+        const size_t cols = board_.getCols();
+        const size_t x = cell % cols;
+        const size_t y = cell / cols;
+        switch (direction)
+        {
+            case Engine::UP:    return y == 0                     ? NONE : cell - cols;
+            case Engine::DOWN:  return y + 1 == board_.getRows()  ? NONE : cell + cols;
+            case Engine::LEFT:  return x == 0                     ? NONE : cell - 1;
+            case Engine::RIGHT: return x + 1 == cols              ? NONE : cell + 1;
+        }
+        return NONE;
+    }
+
+    void
+    Arena::spawn(const size_t snake)
+    {
+        const cell_type cell = randomEmptyCell();
+        dead_[snake] = 0;
+        headOn_[snake] = 0;
+        growing_[snake] = 0;
+        target_[snake] = NONE;
+        score_[snake] = 0;
+        if (cell == NONE) {
+            // A full board: the snake sits out until a later tick frees a cell
+            length_[snake] = 0;
+            dead_[snake] = WAITING;
+            return;
+        }
+
+        head_[snake] = cell;
+        tail_[snake] = cell;
+        length_[snake] = 1;
+        direction_[snake] = DIRECTIONS[random_.below(4)];
+        board_.data()[cell] = FIRST_SNAKE + cell_type(snake);
+    }
+
+    void
+    Arena::placeFruit()
+    {
+        const cell_type cell = randomEmptyCell();
+        if (cell == NONE) { return; }
+        board_.data()[cell] = FRUIT;
+        ++fruits_;
+    }
+
+    Arena::cell_type
+    Arena::randomEmptyCell()
+    {
+        // The arena is meant to be sparse, so random picks nearly always land at once
+        for (size_t i = 0; i < SPAWN_TRIES; ++i) {
+            const cell_type cell = random_.below(board_.size());
+            if (board_[cell] == EMPTY) { return cell; }
+        }
+        const size_t start = random_.below(board_.size());
+        for (size_t i = 0; i < board_.size(); ++i) {
+            const cell_type cell = (start + i) % board_.size();
+            if (board_[cell] == EMPTY) { return cell; }
+        }
+        return NONE;
+    }
+
+    void
+    Arena::chooseTargets(const Engine::Direction* actions, const cell_type* cells, const size_t begin, const size_t end)
+    {
+        const uint64_t stamp = tick_ << 32;
+        for (size_t snake = begin; snake < end; ++snake) {
+            target_[snake] = NONE;
+            growing_[snake] = 0;
+            if (length_[snake] == 0) { continue; }
+
+            // Engine::turn: reversing onto the body is ignored
+            if (actions != nullptr && actions[snake] + direction_[snake] != 10) { direction_[snake] = actions[snake]; }
+            const cell_type target = neighbour(head_[snake], direction_[snake]);
+            if (target == NONE) {
+                dead_[snake] = DIED;
+                continue;
+            }
+
+            target_[snake] = target;
+            growing_[snake] = cells[target] == FRUIT;
+            const uint64_t previous = claims_[target].exchange(stamp | snake, std::memory_order_relaxed);
+            if ((previous >> 32) == tick_) {
+                headOn_[snake].store(1, std::memory_order_relaxed);
+                headOn_[previous & 0xFFFFFFFFull].store(1, std::memory_order_relaxed);
+            }
+        }
+    }
+
+    void
+    Arena::resolveCollisions(const cell_type* cells, const size_t begin, const size_t end)
+    {
+        for (size_t snake = begin; snake < end; ++snake) {
+            const cell_type target = target_[snake];
+            if (target == NONE) { continue; }
+            if (headOn_[snake].load(std::memory_order_relaxed)) {
+                dead_[snake] = DIED;
+                continue;
+            }
+
+            // The board is still the one from the start of the tick
+            const cell_type value = cells[target];
+            if (value >= FIRST_SNAKE) {
+                const size_t owner = value - FIRST_SNAKE;
+                if (target != tail_[owner] || growing_[owner]) { dead_[snake] = DIED; }
+            }
+        }
+    }
+
+    void
+    Arena::moveTails(cell_type* cells, const size_t begin, const size_t end)
+    {
+        for (size_t snake = begin; snake < end; ++snake) {
+            if (length_[snake] == 0) { continue; }
+
+            if (dead_[snake]) {
+                // Clear the whole body, tail to head
+                cell_type cell = tail_[snake];
+                for (size_t i = 0; i < length_[snake]; ++i) {
+                    cells[cell] = EMPTY;
+                    cell = link_[cell];
+                }
+                length_[snake] = 0;
+                continue;
+            }
+
+            if (!growing_[snake]) {
+                const cell_type tail = tail_[snake];
+                cells[tail] = EMPTY;
+                tail_[snake] = length_[snake] == 1 ? target_[snake] : link_[tail];
+                --length_[snake];
+            }
+        }
+    }
+
+    void
+    Arena::moveHeads(cell_type* cells, const size_t begin, const size_t end)
+    {
+        for (size_t snake = begin; snake < end; ++snake) {
+            if (dead_[snake] || growing_[snake]) { events_[eventCount_.fetch_add(1, std::memory_order_relaxed)] = cell_type(snake); }
+            if (dead_[snake] || target_[snake] == NONE) { continue; }
+
+            const cell_type target = target_[snake];
+            link_[head_[snake]] = target;
+            cells[target] = FIRST_SNAKE + cell_type(snake);
+            head_[snake] = target;
+            ++length_[snake];
+            if (growing_[snake]) { ++score_[snake]; }
+        }
+    }
+}
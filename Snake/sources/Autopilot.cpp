@@ -0,0 +1,277 @@
+#include "headers/Autopilot.hpp"
+
+#include <algorithm>
+#include <cassert>
+
+namespace SamHovhannisyan::SnakeGame
+{
+    namespace
+    {
+        const size_t NONE = size_t(-1);
+        /// Cells kept between the head and the tail when cutting across the cycle
+        const size_t SHORTCUT_MARGIN = 3;
+        /// Board-sized rounds without eating after which the fruit is taken even when unsafe
+        const size_t GIVE_UP_ROUNDS = 16;
+    }
+
+    Autopilot::Autopilot(const Engine& engine, const Strategy strategy)
+        : cols_(engine.getBoard().getCols())
+        , rows_(engine.getBoard().getRows())
+        , strategy_(strategy)
+        , visited_(engine.getBoard().size(), 0)
+        , parent_(engine.getBoard().size())
+        , queue_(engine.getBoard().size())
+        , stamp_(0)
+        , pathFruit_(NONE)
+        , tail_(0)
+        , tailMoves_(false)
+        , length_(0)
+        , idle_(0)
+    {
+        path_.reserve(cols_ * rows_);
+        buildCycle();
+    }
+
+    void
+    Autopilot::buildCycle()
+    {
+        // A Hamiltonian cycle needs an even side
+        if (cols_ < 2 || rows_ < 2 || (cols_ % 2 != 0 && rows_ % 2 != 0)) { return; }
+
+        // One border line is the return lane, the rest is covered by a serpentine
+        cycleOrder_.reserve(cols_ * rows_);
+        if (cols_ % 2 == 0) {
+            for (size_t x = 0; x < cols_; ++x) {
+                for (size_t i = 1; i < rows_; ++i) {
+                    const size_t y = x % 2 == 0 ? i : rows_ - i;
+                    cycleOrder_.push_back(y * cols_ + x);
+                }
+            }
+            for (size_t x = cols_; x-- > 0;) { cycleOrder_.push_back(x); }
+        } else {
+            for (size_t y = 0; y < rows_; ++y) {
+                for (size_t i = 1; i < cols_; ++i) {
+                    const size_t x = y % 2 == 0 ? i : cols_ - i;
+                    cycleOrder_.push_back(y * cols_ + x);
+                }
+            }
+            for (size_t y = rows_; y-- > 0;) { cycleOrder_.push_back(y * cols_); }
+        }
+
+        cyclePosition_.resize(cycleOrder_.size());
+        for (size_t i = 0; i < cycleOrder_.size(); ++i) { cyclePosition_[cycleOrder_[i]] = i; }
+    }
+
+    Engine::Direction
+    Autopilot::decide(const Engine& engine)
+    {
+        assert(engine.getBoard().getCols() == cols_ && engine.getBoard().getRows() == rows_);
+        const Engine::Coordinate& head = engine.getHead();
+        const Engine::Coordinate& tail = engine.getBody().back();
+        const size_t headIndex = head.y * cols_ + head.x;
+        tail_ = tail.y * cols_ + tail.x;
+        tailMoves_ = engine.getBody().size() > 1;
+        idle_ = engine.getBody().size() == length_ ? idle_ + 1 : 0;
+        length_ = engine.getBody().size();
+
+        const size_t next = strategy_ == HAMILTONIAN && hasCycle()
+                          ? decideCycle(engine, headIndex)
+                          : decidePath(engine, headIndex);
+        return next == headIndex ? engine.getDirection() : directionTo(headIndex, next);
+    }
+
+    size_t
+    Autopilot::decideCycle(const Engine& engine, const size_t head)
+    {
+        size_t candidates[4];
+        const size_t count = neighbours(engine, head, true, candidates);
+        const size_t area = cycleOrder_.size();
+        const size_t next = cycleOrder_[(cyclePosition_[head] + 1) % area];
+
+        // Off the cycle (only possible while the snake is one cell long): search instead
+        if (std::find(candidates, candidates + count, next) == candidates + count) { return decidePath(engine, head); }
+
+        // Past half of the board plain cycle following is both safe and short enough
+        const size_t length = engine.getBody().size();
+        if (length * 2 >= area) { return next; }
+
+        const Engine::Coordinate& fruit = engine.getFruit();
+        const size_t toFruit = cycleDistance(head, fruit.y * cols_ + fruit.x);
+        const size_t toTail = length == 1 ? area : cycleDistance(head, tail_);
+
+        // Jump ahead along the cycle, but never past the fruit or into the tail's margin
+        size_t best = next;
+        size_t bestDistance = 1;
+        for (size_t i = 0; i < count; ++i) {
+            const size_t distance = cycleDistance(head, candidates[i]);
+            if (distance > bestDistance && distance <= toFruit && distance + SHORTCUT_MARGIN < toTail) {
+                best = candidates[i];
+                bestDistance = distance;
+            }
+        }
+        return best;
+    }
+
+    size_t
+    Autopilot::decidePath(const Engine& engine, const size_t head)
+    {
+        size_t candidates[4];
+        const size_t count = neighbours(engine, head, true, candidates);
+        if (count == 0) { return head; }
+
+        const size_t length = engine.getBody().size();
+        // A step is safe when the tail can still be reached from it with the old head as body
+        const auto safe = [&](const size_t step) {
+            return length == 1 || step == tail_ || search(engine, step, tail_, head);
+        };
+
+        // Shortest path to the fruit, searched again only when the fruit moved
+        const Engine::Coordinate& fruit = engine.getFruit();
+        const size_t fruitIndex = fruit.y * cols_ + fruit.x;
+        if (pathFruit_ != fruitIndex || path_.empty() ||
+            std::find(candidates, candidates + count, path_.back()) == candidates + count)
+        {
+            path_.clear();
+            pathFruit_ = fruitIndex;
+            if (search(engine, head, fruitIndex, NONE, true)) {
+                for (size_t step = fruitIndex; step != head; step = parent_[step]) { path_.push_back(step); }
+            }
+        }
+        // Near a full board the body can settle into a loop that never lets the fruit be
+        // taken safely; rather than circle forever, take it anyway and end the game either way
+        const bool givenUp = idle_ >= GIVE_UP_ROUNDS * cols_ * rows_;
+        if (!path_.empty() && (givenUp || safe(path_.back()))) {
+            const size_t step = path_.back();
+            path_.pop_back();
+            return step;
+        }
+        path_.clear();
+
+        // Follow the tail, along the cycle when there is one; when that has gone on for a
+        // whole board without eating, rotate through the safe moves to leave the loop
+        if (hasCycle() && idle_ < cols_ * rows_) {
+            const size_t next = cycleOrder_[(cyclePosition_[head] + 1) % cycleOrder_.size()];
+            if (std::find(candidates, candidates + count, next) != candidates + count && safe(next)) { return next; }
+        }
+        for (size_t i = 0; i < count; ++i) {
+            const size_t candidate = candidates[(i + idle_) % count];
+            if (safe(candidate)) { return candidate; }
+        }
+
+        // Trapped: take the move with the most room left
+        size_t best = candidates[0];
+        size_t bestRoom = 0;
+        for (size_t i = 0; i < count; ++i) {
+            const size_t space = room(engine, candidates[i], head);
+            if (space > bestRoom) {
+                best = candidates[i];
+                bestRoom = space;
+            }
+        }
+        return best;
+    }
+
+    size_t
+    Autopilot::neighbours(const Engine& engine, const size_t cell, const bool firstStep, size_t* out) const
+    {
+        const size_t x = cell % cols_;
+        const size_t y = cell / cols_;
+        // The engine ignores a turn back onto the neck, so it is never a first step
+        const Engine::Direction reverse = Engine::Direction(10 - engine.getDirection());
+        size_t count = 0;
+
+        if (y > 0         && !(firstStep && reverse == Engine::UP))    { out[count++] = cell - cols_; }
+        if (y + 1 < rows_ && !(firstStep && reverse == Engine::DOWN))  { out[count++] = cell + cols_; }
+        if (x > 0         && !(firstStep && reverse == Engine::LEFT))  { out[count++] = cell - 1; }
+        if (x + 1 < cols_ && !(firstStep && reverse == Engine::RIGHT)) { out[count++] = cell + 1; }
+
+        size_t passable = 0;
+        for (size_t i = 0; i < count; ++i) {
+            if (isPassable(engine, out[i])) { out[passable++] = out[i]; }
+        }
+        return passable;
+    }
+
+    bool
+    Autopilot::isPassable(const Engine& engine, const size_t cell) const
+    {
+        const Engine::BoardElements value = engine.getBoard()[cell];
+        return value == Engine::EMPTY || value == Engine::FRUIT || (cell == tail_ && tailMoves_);
+    }
+
+    bool
+    Autopilot::search(const Engine& engine, const size_t from, const size_t target, const size_t blocked, const bool fromHead)
+    {
+        if (++stamp_ == 0) {
+            std::fill(visited_.begin(), visited_.end(), 0);
+            stamp_ = 1;
+        }
+        visited_[from] = stamp_;
+        if (blocked != NONE) { visited_[blocked] = stamp_; }
+
+        // The engine will not turn the head back, so the cell behind it is no first step
+        size_t behind = NONE;
+        if (fromHead) {
+            switch (engine.getDirection())
+            {
+            case Engine::UP:    behind = from + cols_; break;
+            case Engine::DOWN:  behind = from - cols_; break;
+            case Engine::LEFT:  behind = from + 1;     break;
+            case Engine::RIGHT: behind = from - 1;     break;
+            }
+        }
+
+        size_t first = 0;
+        size_t last = 0;
+        queue_[last++] = from;
+        while (first < last) {
+            const size_t cell = queue_[first++];
+            const bool firstStep = fromHead && cell == from;
+            size_t next[4];
+            const size_t count = neighbours(engine, cell, firstStep, next);
+
+            // The target itself may be occupied (the tail)
+            const size_t x = cell % cols_;
+            const size_t y = cell / cols_;
+            if (!(firstStep && target == behind) &&
+                ((y > 0 && cell - cols_ == target) || (y + 1 < rows_ && cell + cols_ == target) ||
+                 (x > 0 && cell - 1 == target)     || (x + 1 < cols_ && cell + 1 == target)))
+            {
+                parent_[target] = cell;
+                return true;
+            }
+
+            for (size_t i = 0; i < count; ++i) {
+                if (visited_[next[i]] == stamp_) { continue; }
+                visited_[next[i]] = stamp_;
+                parent_[next[i]] = cell;
+                queue_[last++] = next[i];
+            }
+        }
+        return false;
+    }
+
+    size_t
+    Autopilot::room(const Engine& engine, const size_t from, const size_t blocked)
+    {
+        search(engine, from, NONE, blocked);
+        // A search for no target visits the whole region; everything stamped belongs to it
+        return std::count(visited_.begin(), visited_.end(), stamp_) - 1;
+    }
+
+    size_t
+    Autopilot::cycleDistance(const size_t from, const size_t to) const
+    {
+        const size_t area = cycleOrder_.size();
+        return (cyclePosition_[to] + area - cyclePosition_[from]) % area;
+    }
+
+    Engine::Direction
+    Autopilot::directionTo(const size_t head, const size_t cell) const
+    {
+        if (cell + cols_ == head) { return Engine::UP; }
+        if (cell == head + cols_) { return Engine::DOWN; }
+        if (cell + 1 == head)     { return Engine::LEFT; }
+        return Engine::RIGHT;
+    }
+}
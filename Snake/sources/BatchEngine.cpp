@@ -0,0 +1,197 @@
+#include "headers/BatchEngine.hpp"
+
+#include <algorithm>
+#include <cassert>
+#include <cstring>
+#include <numeric>
+#include <stdexcept>
+
+namespace SamHovhannisyan::SnakeGame
+{
+    namespace
+    {
+        /// Rejection samples tried before counting the free cells
+        const size_t FRUIT_TRIES = 8;
+    }
+
+    BatchEngine::BatchEngine(const size_t games, const size_t width, const size_t height,
+                             const size_t threads, const uint64_t seed)
+        : games_(games)
+        , cols_(width)
+        , rows_(height)
+        , cells_(width * height)
+        , words_((width * height + 63) / 64)
+        , head_(games)
+        , fruit_(games)
+        , length_(games)
+        , bodyStart_(games)
+        , direction_(games)
+        , random_(games)
+        , episodes_(games, 0)
+        , totalScore_(games, 0)
+        , body_(games * width * height)
+        , occupancy_(games * ((width * height + 63) / 64))
+        , observations_(games * width * height)
+        , rewards_(games, 0)
+        , done_(games, 0)
+        , pool_(threads)
+    {
+        if (cells_ < 2) { throw std::invalid_argument("BatchEngine: the board needs at least two cells"); }
+        for (size_t game = 0; game < games_; ++game) { random_[game] = Random::SplitMix64(seed + game * 0x9E3779B97F4A7C15ull); }
+        reset();
+    }
+
+    void
+    BatchEngine::reset()
+    {
+        pool_.parallelFor(games_, [this](const size_t begin, const size_t end) {
+            for (size_t game = begin; game < end; ++game) {
+                resetGame(game);
+                rewards_[game] = 0;
+                done_[game] = 0;
+            }
+        });
+    }
+
+    void
+    BatchEngine::step(const Engine::Direction* actions)
+    {
+        pool_.parallelFor(games_, [this, actions](const size_t begin, const size_t end) {
+            for (size_t game = begin; game < end; ++game) {
+                stepGame(game, actions != nullptr ? actions[game] : Engine::Direction(direction_[game]));
+            }
+        });
+    }
+
+    size_t
+    BatchEngine::getEpisodes() const
+    {
+        return std::accumulate(episodes_.begin(), episodes_.end(), size_t(0));
+    }
+
+    size_t
+    BatchEngine::getTotalScore() const
+    {
+        return std::accumulate(totalScore_.begin(), totalScore_.end(), size_t(0));
+    }
+
+    void
+    BatchEngine::resetGame(const size_t game)
+    {
+        std::fill_n(occupancy_.begin() + game * words_, words_, 0);
+        std::memset(observations_.data() + game * cells_, Engine::EMPTY, cells_);
+
+        // Same start as Engine::reset: one cell in the middle, heading right
+        const cell_type head = (rows_ / 2) * cols_ + cols_ / 2;
+        head_[game] = head;
+        length_[game] = 1;
+        bodyStart_[game] = 0;
+        body_[game * cells_] = head;
+        direction_[game] = Engine::RIGHT;
+        occupancy_[game * words_ + head / 64] |= word_type(1) << (head % 64);
+        observations_[game * cells_ + head] = Engine::SNAKE_HEAD;
+        placeFruit(game);
+    }
+
+    void
+    BatchEngine::stepGame(const size_t game, const Engine::Direction action)
+    {
+        rewards_[game] = 0;
+        done_[game] = 0;
+
+        // Engine::turn: reversing onto the body is ignored
+        const uint8_t direction = direction_[game];
+        if (action + direction != 10) { direction_[game] = action; }
+
+        const cell_type head = head_[game];
+        const size_t x = head % cols_;
+        const size_t y = head / cols_;
+        cell_type newHead = head;
+        switch (direction_[game])
+        {
+            case Engine::UP:    if (y == 0)         { finishGame(game, REWARD_DEATH); return; } newHead -= cols_; break;
+            case Engine::DOWN:  if (y + 1 == rows_) { finishGame(game, REWARD_DEATH); return; } newHead += cols_; break;
+            case Engine::LEFT:  if (x == 0)         { finishGame(game, REWARD_DEATH); return; } --newHead; break;
+            case Engine::RIGHT: if (x + 1 == cols_) { finishGame(game, REWARD_DEATH); return; } ++newHead; break;
+        }
+
+        // The cell the tail leaves this tick is free unless the snake grows
+        cell_type* body = body_.data() + game * cells_;
+        uint8_t* observation = observations_.data() + game * cells_;
+        word_type* occupancy = occupancy_.data() + game * words_;
+        const bool growing = newHead == fruit_[game];
+        const cell_type tailSlot = (bodyStart_[game] + length_[game] - 1) % cells_;
+        const cell_type tail = body[tailSlot];
+        if (isOccupied(game, newHead) && (growing || newHead != tail)) {
+            finishGame(game, REWARD_DEATH);
+            return;
+        }
+
+        if (!growing) {
+            occupancy[tail / 64] &= ~(word_type(1) << (tail % 64));
+            observation[tail] = Engine::EMPTY;
+            --length_[game];
+        }
+        if (length_[game] != 0) { observation[head] = Engine::SNAKE_BODY; }
+
+        bodyStart_[game] = (bodyStart_[game] + cells_ - 1) % cells_;
+        body[bodyStart_[game]] = newHead;
+        ++length_[game];
+        head_[game] = newHead;
+        occupancy[newHead / 64] |= word_type(1) << (newHead % 64);
+        observation[newHead] = Engine::SNAKE_HEAD;
+
+        if (growing) {
+            rewards_[game] = REWARD_FRUIT;
+            if (length_[game] == cells_) {
+                finishGame(game, REWARD_FRUIT);
+                return;
+            }
+            placeFruit(game);
+        }
+    }
+
+    void
+    BatchEngine::finishGame(const size_t game, const int8_t reward)
+    {
+        rewards_[game] = reward;
+        done_[game] = 1;
+        ++episodes_[game];
+        totalScore_[game] += length_[game] - 1;
+        resetGame(game);
+    }
+
+    void
+    BatchEngine::placeFruit(const size_t game)
+    {
+        assert(length_[game] < cells_);
+        Random::SplitMix64& random = random_[game];
+
+        // A short snake leaves most cells free, so a few blind picks almost always land
+        cell_type cell = cells_;
+        for (size_t i = 0; i < FRUIT_TRIES; ++i) {
+            const cell_type pick = random.below(cells_);
+            if (!isOccupied(game, pick)) { cell = pick; break; }
+        }
+
+        // Otherwise pick the k-th free cell, counting free bits a word at a time
+        if (cell == cells_) {
+            size_t k = random.below(cells_ - length_[game]);
+            const word_type* occupancy = occupancy_.data() + game * words_;
+            for (size_t word = 0; word < words_; ++word) {
+                const size_t bits = std::min<size_t>(64, cells_ - word * 64);
+                word_type free = ~occupancy[word];
+                if (bits < 64) { free &= (word_type(1) << bits) - 1; }
+                const size_t count = __builtin_popcountll(free);
+                if (k >= count) { k -= count; continue; }
+                for (; k > 0; --k) { free &= free - 1; }
+                cell = cell_type(word * 64 + __builtin_ctzll(free));
+                break;
+            }
+        }
+
+        assert(cell < cells_);
+        fruit_[game] = cell;
+        observations_[game * cells_ + cell] = Engine::FRUIT;
+    }
+}
@@ -0,0 +1,231 @@
+#include "headers/Engine.hpp"
+
+#include <algorithm>
+#include <stdexcept>
+
+namespace SamHovhannisyan::SnakeGame
+{
+    const uint32_t Engine::SNAPSHOT_KIND = Snapshot::kindOf("SNAK");
+
+    Engine::Engine(const size_t width, const size_t height, const uint64_t seed)
+        : board_(width, height)
+        , snakeBody_(board_.size())
+        , freeCells_(board_.size())
+    {
+        freeCells_.fill();
+        reset(seed);
+    }
+
+    void
+    Engine::reset()
+    {
+        reset(random_());
+    }
+
+    void
+    Engine::reset(const uint64_t seed)
+    {
+        seed_ = seed;
+        random_ = Random::SplitMix64(seed);
+        fruitCount_ = 0;
+
+        // Hand the cells of the previous game back instead of refilling the whole set
+        for (size_t i = 0; i < snakeBody_.size(); ++i) { freeCells_.insert(board_.indexOf(snakeBody_[i])); }
+        freeCells_.insert(board_.indexOf(fruit_.coordinate));
+
+        board_.fill(EMPTY);
+        direction_ = RIGHT;
+        level_ = 1;
+        speed_ = 200000;
+        game_over_ = false;
+        snakeHead_.x = board_.getCols() / 2;
+        snakeHead_.y = board_.getRows() / 2;
+        snakeBody_.clear();
+        snakeBody_.push_front(snakeHead_);
+        board_(snakeHead_) = SNAKE_HEAD;
+        freeCells_.erase(board_.indexOf(snakeHead_));
+        placeFruit();
+    }
+
+    bool
+    Engine::step()
+    {
+        if (game_over_) { return false; }
+        moveSnake();
+        return !game_over_;
+    }
+
+    void
+    Engine::moveSnake()
+    {
+        Coordinate newHead = snakeHead_;
+        switch (direction_)
+        {
+            case UP:    --newHead.y; break;
+            case DOWN:  ++newHead.y; break;
+            case LEFT:  --newHead.x; break;
+            case RIGHT: ++newHead.x; break;
+        }
+
+        // Leaving the board ends the game before anything is written
+        if (newHead.x >= board_.getCols() || newHead.y >= board_.getRows()) {
+            game_over_ = true;
+            return;
+        }
+
+        // The grid answers self-collision; the cell the tail leaves this tick is free
+        const bool growing = newHead == fruit_.coordinate;
+        const Coordinate tail = snakeBody_.back();
+        if (board_.getBoard()(newHead) == SNAKE_BODY && (growing || newHead != tail)) {
+            game_over_ = true;
+            return;
+        }
+
+        if (!growing) {
+            snakeBody_.pop_back();
+            board_(tail) = EMPTY;
+            freeCells_.insert(board_.indexOf(tail));
+        }
+        if (!snakeBody_.empty()) { board_(snakeHead_) = SNAKE_BODY; }
+        snakeBody_.push_front(newHead);
+        board_(newHead) = SNAKE_HEAD;
+        freeCells_.erase(board_.indexOf(newHead));
+        snakeHead_ = newHead;
+
+        if (growing) { eatFruit(); }
+    }
+
+    void
+    Engine::turn(const Direction newDirection)
+    {
+        if ((direction_ == UP    && newDirection != DOWN ) ||
+            (direction_ == DOWN  && newDirection != UP   ) ||
+            (direction_ == LEFT  && newDirection != RIGHT) ||
+            (direction_ == RIGHT && newDirection != LEFT))
+        {
+            direction_ = newDirection;
+        }
+    }
+
+    void
+    Engine::placeFruit()
+    {
+        // If no empty spots left, end game
+        if (freeCells_.empty()) {
+            game_over_ = true;
+            return;
+        }
+
+        // Select random empty spot
+        const size_t index = freeCells_[random_.below(freeCells_.size())];
+        freeCells_.erase(index);
+        fruit_.coordinate = board_.coordinateOf(index);
+        board_(fruit_.coordinate) = FRUIT;
+        ++fruitCount_;
+    }
+
+    void
+    Engine::eatFruit()
+    {
+        placeFruit();
+
+        if (fruitCount_ % 3 == 0 && speed_ > 20000) {
+            speed_ -= 10000;
+            level_++;
+        }
+    }
+
+    void
+    Engine::save(const std::string& path) const
+    {
+        Snapshot::save(path, SNAPSHOT_KIND, board_, saveState());
+    }
+
+    void
+    Engine::load(const std::string& path)
+    {
+        const Snapshot::MappedBoard<BoardElements> snapshot(path, SNAPSHOT_KIND);
+        const auto view = snapshot.getBoard();
+        Snapshot::StateReader state = snapshot.getState();
+
+        board_.resize(view.getRows(), view.getCols());
+        Snapshot::restore(view, board_);
+        readState(state);
+    }
+
+    void
+    Engine::restoreState(const std::string& bytes)
+    {
+        Snapshot::StateReader state(bytes.data(), bytes.size());
+        readState(state);
+
+        board_.fill(EMPTY);
+        for (size_t i = 0; i < snakeBody_.size(); ++i) { board_(snakeBody_[i]) = i == 0 ? SNAKE_HEAD : SNAKE_BODY; }
+        // After the board filled up the last fruit is under the head
+        if (board_(fruit_.coordinate) == EMPTY) { board_(fruit_.coordinate) = FRUIT; }
+    }
+
+    void
+    Engine::readState(Snapshot::StateReader& state)
+    {
+        snakeBody_ = body_type(board_.size());
+        fruit_.coordinate.x = state.get<uint64_t>();
+        fruit_.coordinate.y = state.get<uint64_t>();
+        snakeHead_.x = state.get<uint64_t>();
+        snakeHead_.y = state.get<uint64_t>();
+        const size_t length = state.get<uint64_t>();
+        if (length > snakeBody_.capacity()) { throw std::runtime_error("Snapshot snake is longer than its board"); }
+        for (size_t i = 0; i < length; ++i) {
+            Coordinate segment;
+            segment.x = state.get<uint64_t>();
+            segment.y = state.get<uint64_t>();
+            if (segment.x >= board_.getCols() || segment.y >= board_.getRows())
+            { throw std::runtime_error("Snapshot snake is off the board"); }
+            snakeBody_.push_back(segment);
+        }
+        direction_ = state.get<Direction>();
+        level_ = state.get<uint64_t>();
+        speed_ = state.get<uint64_t>();
+        game_over_ = state.get<bool>();
+        fruitCount_ = state.get<uint64_t>();
+        seed_ = state.get<uint64_t>();
+        random_.setState(state.get<uint64_t>());
+        if (fruit_.coordinate.x >= board_.getCols() || fruit_.coordinate.y >= board_.getRows())
+        { throw std::runtime_error("Snapshot fruit is off the board"); }
+
+        // The order of the free cells decides where the next fruit lands, so it is state too
+        const size_t freeCount = state.get<uint64_t>();
+        if (freeCount > board_.size()) { throw std::runtime_error("Snapshot has more free cells than its board"); }
+        freeCells_ = SparseSet::SparseSet(board_.size());
+        for (size_t i = 0; i < freeCount; ++i) {
+            const size_t index = state.get<uint32_t>();
+            if (index >= board_.size()) { throw std::runtime_error("Snapshot free cell is off the board"); }
+            freeCells_.insert(index);
+        }
+    }
+
+    Snapshot::StateWriter
+    Engine::saveState() const
+    {
+        Snapshot::StateWriter state;
+        state.put<uint64_t>(fruit_.coordinate.x);
+        state.put<uint64_t>(fruit_.coordinate.y);
+        state.put<uint64_t>(snakeHead_.x);
+        state.put<uint64_t>(snakeHead_.y);
+        state.put<uint64_t>(snakeBody_.size());
+        for (size_t i = 0; i < snakeBody_.size(); ++i) {
+            state.put<uint64_t>(snakeBody_[i].x);
+            state.put<uint64_t>(snakeBody_[i].y);
+        }
+        state.put(direction_);
+        state.put<uint64_t>(level_);
+        state.put<uint64_t>(speed_);
+        state.put(game_over_);
+        state.put<uint64_t>(fruitCount_);
+        state.put<uint64_t>(seed_);
+        state.put<uint64_t>(random_.getState());
+        state.put<uint64_t>(freeCells_.size());
+        for (const size_t index : freeCells_) { state.put<uint32_t>(index); }
+        return state;
+    }
+}
@@ -1,141 +1,217 @@
 #include "headers/Game.hpp"
+
+#include <sys/ioctl.h>
+
 #include <algorithm>
+#include <iostream>
 
 namespace SamHovhannisyan::SnakeGame 
 {
+    namespace
+    {
+        const size_t CHECKPOINT_TICKS = 50;
+        const int64_t NANOSECONDS_PER_MICROSECOND = 1000;
+        const size_t MAX_REPLAY_SPEEDUP = 64;
+        /// The border around the board and the status line under it
+        const int BORDER = 1;
+        const int STATUS_ROWS = 1;
+        /// Cells kept between the head and the edge of a window smaller than the board
+        const size_t HEAD_MARGIN = 4;
+    }
+
     Snake::Snake(const size_t width, const size_t height) 
-        : board_(width, height)
-        , direction_(RIGHT)
-        , level_(1)
-        , speed_(200000)
-        , game_over_(false)
+        : engine_(width, height)
+        , scheduler_(engine_.getSpeed() * NANOSECONDS_PER_MICROSECOND)
+        , ticks_(0)
+        , lines_(0)
+        , cols_(0)
     {
-        std::srand(std::time(0));
-        snakeHead_.x = width / 2;
-        snakeHead_.y = height / 2;
-        snakeBody_.push_back(snakeHead_);
-        placeFruit();
+        engine_.setDirtyTracking(true);
     }
 
     void 
     Snake::start() 
     {
-        initscr();
-        noecho();
-        cbreak();
-        keypad(stdscr, TRUE);
-        nodelay(stdscr, TRUE);
-        initializeColors();
+        openScreen();
+        input_.start();
+        if (!recording_.empty()) { replay_.begin(engine_); }
+
+        drawBoard();
+        scheduler_.setPeriod(engine_.getSpeed() * NANOSECONDS_PER_MICROSECOND);
+        scheduler_.restart();
+        while (!engine_.isGameOver()) {
+            // Ticks run on absolute deadlines; when behind, the missed ticks run back to back
+            const size_t due = scheduler_.wait();
+            for (size_t tick = 0; tick < due && !engine_.isGameOver(); ++tick) {
+                const int64_t pressed = handleInput();
+                engine_.step();
+                if (pressed != 0) { latency_.record(Scheduler::now() - pressed); }
+                if (!recording_.empty()) { replay_.record(engine_); }
+                if (!checkpoint_.empty() && ++ticks_ % CHECKPOINT_TICKS == 0) {
+                    writer_.write(checkpoint_, Engine::SNAPSHOT_KIND, engine_.getBoard(), engine_.saveState());
+                }
+            }
+            scheduler_.setPeriod(engine_.getSpeed() * NANOSECONDS_PER_MICROSECOND);
 
-        while (!game_over_) {
-            handleInput();
-            moveSnake();
-            checkCollision();
-            drawBoard();
-            usleep(speed_);
+            // A frame is only drawn if it fits before the next tick; skipped cells stay dirty
+            const bool render = scheduler_.shouldRender();
+            if (render) { drawBoard(); }
+            scheduler_.rendered(render);
         }
 
+        input_.stop();
+        writer_.wait();
         renderGameOver();
         sleep(3);
         endwin();
+
+        if (!recording_.empty()) {
+            try { replay_.save(recording_); }
+            catch (const std::exception& e) { std::cerr << e.what() << std::endl; }
+        }
     }
 
-    void 
-    Snake::drawBoard() const
+    void
+    Snake::watch(const std::string& path)
     {
-        clear();
-        
-        // Draw game area with border offset
-        for (size_t y = 0; y < board_.getRows(); ++y) {
-            for (size_t x = 0; x < board_.getCols(); ++x) {
-                Coordinate::Coordinate pos(x, y);
-                int displayChar = '.';
-                int colorPair = 0;
-                
-                if (pos == snakeHead_) {
-                    displayChar = '@';
-                    colorPair = 1;
-                }
-                else if (std::find(snakeBody_.begin(), snakeBody_.end(), pos) != snakeBody_.end()) {
-                    displayChar = 'O';
-                    colorPair = 1;
-                }
-                else if (pos == fruit_.coordinate) {
-                    displayChar = '*';
-                    colorPair = 2;
-                }
-                
-                mvaddch(y + 1, x + 1, displayChar | COLOR_PAIR(colorPair));
+        replay_.load(path);
+        engine_ = Engine(replay_.getRows(), replay_.getCols(), replay_.getSeed());
+        engine_.setDirtyTracking(true);
+        replay_.seek(engine_, 0);
+        openScreen();
+
+        size_t tick = 0;
+        size_t speedup = 1;
+        bool paused = false;
+        bool quit = false;
+        drawBoard();
+        scheduler_.setPeriod(engine_.getSpeed() * NANOSECONDS_PER_MICROSECOND);
+        scheduler_.restart();
+        while (!quit) {
+            // Seeking restores the nearest keyframe, so a jump costs at most one interval of ticks
+            const size_t jump = replay_.getKeyframeTicks();
+            switch (getch())
+            {
+                case ' ':       paused = !paused; break;
+                case '+':       speedup = std::min<size_t>(speedup * 2, MAX_REPLAY_SPEEDUP); break;
+                case '-':       speedup = std::max<size_t>(speedup / 2, 1); break;
+                case 'q':       quit = true; break;
+                case KEY_LEFT:  tick = tick > jump ? tick - jump : 0; replay_.seek(engine_, tick); break;
+                case KEY_RIGHT: tick = std::min(tick + jump, replay_.getTicks()); replay_.seek(engine_, tick); break;
             }
+
+            const size_t due = scheduler_.wait();
+            for (size_t i = 0; i < due && !paused && tick < replay_.getTicks(); ++i, ++tick) {
+                engine_.turn(replay_.getDirection(tick));
+                engine_.step();
+            }
+            scheduler_.setPeriod(engine_.getSpeed() * NANOSECONDS_PER_MICROSECOND / speedup);
+
+            const bool render = scheduler_.shouldRender();
+            if (render) {
+                drawBoard();
+                mvprintw(int(viewport_.getRows()) + 2 * BORDER, 2, "Replay tick %zu / %zu  x%-3zu %s",
+                         tick, replay_.getTicks(), speedup, paused ? "[paused]" : "        ");
+                refresh();
+            }
+            scheduler_.rendered(render);
         }
-        
-        // Draw border
-        attron(COLOR_PAIR(3));
-        for (size_t x = 0; x < board_.getCols() + 2; x++) {
-            mvaddch(0, x, '#');
-            mvaddch(board_.getRows() + 1, x, '#');
-        }
-        for (size_t y = 0; y < board_.getRows() + 2; y++) {
-            mvaddch(y, 0, '#');
-            mvaddch(y, board_.getCols() + 1, '#');
-        }
-        attroff(COLOR_PAIR(3));
-        
-        // Draw score
-        mvprintw(0, 2, "Score: %zu", snakeBody_.size());
-        
-        refresh();
+
+        endwin();
+    }
+
+    void
+    Snake::openScreen()
+    {
+        initscr();
+        noecho();
+        cbreak();
+        keypad(stdscr, TRUE);
+        nodelay(stdscr, TRUE);
+        initializeColors();
     }
 
     void 
-    Snake::moveSnake() 
+    Snake::drawBoard()
     {
-        Coordinate::Coordinate newHead = snakeHead_;
-        switch (direction_) 
-        {
-            case UP:    --newHead.y; break;
-            case DOWN:  ++newHead.y; break;
-            case LEFT:  --newHead.x; break;
-            case RIGHT: ++newHead.x; break;
-        }
+        const Engine::board_type& board = engine_.getBoard();
+
+        // Only cells written since the last frame are repainted; the screen is never cleared
+        // unless the window moved. Either way only the cells inside the viewport are drawn.
+        const bool moved = layout();
+        const Coordinate::Coordinate& origin = viewport_.getOrigin();
+        const size_t endX = origin.x + viewport_.getCols();
+        const size_t endY = origin.y + viewport_.getRows();
+        if (moved || board.isAllDirty()) {
+            clear();
+            for (size_t y = origin.y; y < endY; ++y) {
+                for (size_t x = origin.x; x < endX; ++x) { drawCell({x, y}); }
+            }
 
-        snakeBody_.insert(snakeBody_.begin(), newHead);
-        if (newHead == fruit_.coordinate) {
-            eatFruit();
+            // Draw border
+            const int bottom = int(viewport_.getRows()) + BORDER;
+            const int right = int(viewport_.getCols()) + BORDER;
+            attron(COLOR_PAIR(3));
+            for (int x = 0; x <= right; x++) {
+                mvaddch(0, x, '#');
+                mvaddch(bottom, x, '#');
+            }
+            for (int y = 0; y <= bottom; y++) {
+                mvaddch(y, 0, '#');
+                mvaddch(y, right, '#');
+            }
+            attroff(COLOR_PAIR(3));
         } else {
-            snakeBody_.pop_back();
+            for (const size_t index : board.getDirty()) { 
+                const Coordinate::Coordinate pos = board.coordinateOf(index);
+                if (viewport_.isVisible(pos)) { drawCell(pos); }
+            }
         }
-        snakeHead_ = newHead;
+        engine_.clearDirty();
+        
+        // Draw score
+        mvprintw(0, 2, "Score: %zu", engine_.getBody().size());
+        
+        refresh();
     }
 
-    void
-    Snake::changeDirection(Direction newDirection) 
+    bool
+    Snake::layout()
     {
-        if ((direction_ == UP    && newDirection != DOWN ) ||
-            (direction_ == DOWN  && newDirection != UP   ) ||
-            (direction_ == LEFT  && newDirection != RIGHT) ||
-            (direction_ == RIGHT && newDirection != LEFT)) 
-        {
-            direction_ = newDirection;
+        // Keys are read off stdin by the input thread, so KEY_RESIZE never reaches getch()
+        // during play; the terminal size is asked for directly instead
+        winsize size;
+        if (ioctl(STDOUT_FILENO, TIOCGWINSZ, &size) == 0 && is_term_resized(size.ws_row, size.ws_col)) {
+            resizeterm(size.ws_row, size.ws_col);
+        }
+
+        bool moved = false;
+        if (LINES != lines_ || COLS != cols_) {
+            lines_ = LINES;
+            cols_ = COLS;
+            const Engine::board_type& board = engine_.getBoard();
+            viewport_.setBoard(board.getRows(), board.getCols());
+            viewport_.setScreen(BORDER, BORDER, LINES - 2 * BORDER - STATUS_ROWS, COLS - 2 * BORDER);
+            moved = true;
         }
+        return viewport_.follow(engine_.getHead(), HEAD_MARGIN) || moved;
     }
 
     void
-    Snake::checkCollision()
+    Snake::drawCell(const Coordinate::Coordinate& pos) const
     {
-        if (snakeHead_.x >= board_.getCols() ||
-            snakeHead_.y >= board_.getRows()) 
+        int displayChar = '.';
+        int colorPair = 0;
+        
+        switch (engine_.getBoard()(pos))
         {
-            game_over_ = true;
-            return;
-        }
-
-        for (size_t i = 1; i < snakeBody_.size(); ++i) {
-            if (snakeHead_ == snakeBody_[i]) {
-                game_over_ = true;
-                return;
-            }
+        case Engine::SNAKE_HEAD: displayChar = '@'; colorPair = 1; break;
+        case Engine::SNAKE_BODY: displayChar = 'O'; colorPair = 1; break;
+        case Engine::FRUIT:      displayChar = '*'; colorPair = 2; break;
+        case Engine::EMPTY:      break;
         }
+        
+        mvaddch(viewport_.screenY(pos.y), viewport_.screenX(pos.x), displayChar | COLOR_PAIR(colorPair));
     }
 
     void 
@@ -147,67 +223,79 @@ namespace SamHovhannisyan::SnakeGame
         init_pair(3, COLOR_WHITE, COLOR_BLACK);  // Border
     }
 
-    void 
+    int64_t
     Snake::handleInput() 
     {
-        int ch = getch();
-        switch (ch) 
-        {
-            case KEY_UP:    changeDirection(UP);    break;
-            case KEY_DOWN:  changeDirection(DOWN);  break;
-            case KEY_LEFT:  changeDirection(LEFT);  break;
-            case KEY_RIGHT: changeDirection(RIGHT); break;
+        KeyPress press;
+        if (autopilot_) {
+            while (input_.pop(press)) {}
+            engine_.turn(autopilot_->decide(engine_));
+            return 0;
         }
-    }
 
-    void 
-    Snake::placeFruit()
-    {
-        std::vector<Coordinate::Coordinate> emptySpots;
-    
-        // Find all empty spots on the board
-        for (size_t y = 0; y < board_.getRows(); ++y) {
-            for (size_t x = 0; x < board_.getCols(); ++x) {
-                Coordinate::Coordinate pos(x, y);
-                
-                // Check if position is not occupied by snake
-                if (pos != snakeHead_ && 
-                    std::find(snakeBody_.begin(), snakeBody_.end(), pos) == snakeBody_.end()) 
-                {
-                    emptySpots.push_back(pos);
-                }
-            }
-        }
-        
-        // If no empty spots left, end game
-        if (emptySpots.empty()) {
-            game_over_ = true;
-            return;
-        }
-        
-        // Select random empty spot
-        size_t randomIndex = std::rand() % emptySpots.size();
-        fruit_.coordinate = emptySpots[randomIndex];
-        Fruit::Fruit::FRUIT_COUNT++;
-    }
-
-    void
-    Snake::eatFruit()
-    {
-        placeFruit();
-        
-        if (Fruit::Fruit::FRUIT_COUNT % 3 == 0 && speed_ > 20000) {
-            speed_ -= 10000;
-            level_++;
+        // One turn per tick, in the order the keys were pressed: a quick UP then LEFT inside
+        // one tick becomes two consecutive turns. Presses that change nothing are skipped.
+        while (input_.pop(press)) {
+            const Engine::Direction before = engine_.getDirection();
+            engine_.turn(press.direction);
+            if (engine_.getDirection() != before) { return press.time; }
         }
+        return 0;
     }
 
     void
     Snake::renderGameOver() const
     {
         clear();
-        mvprintw(0, 2, "Game Over. Your score: %zu", snakeBody_.size() - 1);
+        mvprintw(0, 2, "Game Over. Your score: %zu", engine_.getScore());
+
+        const Scheduler::Statistics& statistics = scheduler_.getStatistics();
+        mvprintw(2, 2, "Ticks: %zu | Frames: %zu drawn, %zu skipped", 
+                 statistics.ticks, statistics.renders, statistics.skippedRenders);
+        mvprintw(3, 2, "Jitter: %.1f us mean, %.1f us max", 
+                 statistics.meanJitter() / 1000.0, statistics.maxJitter / 1000.0);
+        mvprintw(4, 2, "Overruns: %zu (worst %.1f us late), dropped ticks: %zu", 
+                 statistics.overruns, statistics.maxOverrun / 1000.0, statistics.droppedTicks);
+        mvprintw(5, 2, "Input to move: %zu turns, %.1f ms median, %.1f ms p99, %.1f ms max, %zu keys dropped",
+                 latency_.count(), latency_.percentile(50) / 1e6, latency_.percentile(99) / 1e6,
+                 latency_.max() / 1e6, input_.getDropped());
         refresh();
         getch();
     }
+
+    void
+    Snake::save(const std::string& path) const
+    {
+        engine_.save(path);
+    }
+
+    void
+    Snake::load(const std::string& path)
+    {
+        engine_.load(path);
+    }
+
+    void
+    Snake::setCheckpoint(const std::string& path)
+    {
+        checkpoint_ = path;
+    }
+
+    void
+    Snake::setSeed(const uint64_t seed)
+    {
+        engine_.reset(seed);
+    }
+
+    void
+    Snake::setRecording(const std::string& path)
+    {
+        recording_ = path;
+    }
+
+    void
+    Snake::setAutopilot(const Autopilot::Strategy strategy)
+    {
+        autopilot_.reset(new Autopilot(engine_, strategy));
+    }
 }
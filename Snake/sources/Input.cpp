@@ -0,0 +1,90 @@
+#include "headers/Input.hpp"
+#include "../resources/headers/Scheduler.hpp"
+
+#include <poll.h>
+#include <unistd.h>
+
+namespace SamHovhannisyan::SnakeGame
+{
+    namespace
+    {
+        /// How often the reader wakes up to notice stop() when no key comes
+        const int POLL_MILLISECONDS = 50;
+    }
+
+    Input::Input()
+        : running_(false)
+        , dropped_(0)
+        , fd_(0)
+    {}
+
+    Input::~Input()
+    {
+        stop();
+    }
+
+    void
+    Input::start(const int fd)
+    {
+        if (running_) { return; }
+        fd_ = fd;
+        pending_.clear();
+        running_ = true;
+        thread_ = std::thread(&Input::run, this);
+    }
+
+    void
+    Input::stop()
+    {
+        running_ = false;
+        if (thread_.joinable()) { thread_.join(); }
+    }
+
+    size_t
+    Input::decode(const char* bytes, const size_t size, Engine::Direction& direction, bool& isArrow)
+    {
+        isArrow = false;
+        if (size == 0) { return 0; }
+        if (bytes[0] != '\033') { return 1; }
+
+        // ESC [ A or, in keypad transmit mode, ESC O A
+        if (size < 3) { return 0; }
+        if (bytes[1] != '[' && bytes[1] != 'O') { return 1; }
+        switch (bytes[2])
+        {
+            case 'A': direction = Engine::UP;    break;
+            case 'B': direction = Engine::DOWN;  break;
+            case 'C': direction = Engine::RIGHT; break;
+            case 'D': direction = Engine::LEFT;  break;
+            default: return 3;
+        }
+        isArrow = true;
+        return 3;
+    }
+
+    void
+    Input::run()
+    {
+        while (running_) {
+            pollfd descriptor = { fd_, POLLIN, 0 };
+            if (::poll(&descriptor, 1, POLL_MILLISECONDS) <= 0 || (descriptor.revents & POLLIN) == 0) { continue; }
+
+            char buffer[64];
+            const ssize_t count = ::read(fd_, buffer, sizeof(buffer));
+            if (count <= 0) { continue; }
+            const int64_t time = Scheduler::now();
+            pending_.append(buffer, size_t(count));
+
+            size_t offset = 0;
+            while (offset < pending_.size()) {
+                Engine::Direction direction;
+                bool isArrow;
+                const size_t used = decode(pending_.data() + offset, pending_.size() - offset, direction, isArrow);
+                if (used == 0) { break; }
+                offset += used;
+                if (isArrow && !queue_.push({ direction, time })) { ++dropped_; }
+            }
+            pending_.erase(0, offset);
+        }
+    }
+}
@@ -0,0 +1,187 @@
+#include "headers/Replay.hpp"
+
+#include <algorithm>
+#include <cassert>
+#include <fstream>
+#include <stdexcept>
+
+namespace SamHovhannisyan::SnakeGame
+{
+    namespace
+    {
+        const Engine::Direction DIRECTIONS[4] = { Engine::UP, Engine::DOWN, Engine::LEFT, Engine::RIGHT };
+
+        uint64_t
+        directionCode(const Engine::Direction direction)
+        {
+            return std::find(DIRECTIONS, DIRECTIONS + 4, direction) - DIRECTIONS;
+        }
+
+        void
+        putVarint(Snapshot::StateWriter& writer, uint64_t value)
+        {
+            while (value >= 0x80) {
+                writer.put<uint8_t>(uint8_t(value) | 0x80);
+                value >>= 7;
+            }
+            writer.put<uint8_t>(uint8_t(value));
+        }
+
+        uint64_t
+        getVarint(Snapshot::StateReader& reader)
+        {
+            uint64_t value = 0;
+            for (size_t shift = 0; shift < 64; shift += 7) {
+                const uint8_t byte = reader.get<uint8_t>();
+                value |= uint64_t(byte & 0x7F) << shift;
+                if ((byte & 0x80) == 0) { return value; }
+            }
+            throw std::runtime_error("Replay varint is too long");
+        }
+    }
+
+    const uint32_t Replay::REPLAY_KIND = Snapshot::kindOf("SNRP");
+
+    Replay::Replay(const size_t keyframeTicks)
+        : keyframeTicks_(keyframeTicks)
+        , rows_(0)
+        , cols_(0)
+        , seed_(0)
+        , ticks_(0)
+        , last_(Engine::Direction(0))
+    {
+        if (keyframeTicks_ == 0) { throw std::invalid_argument("Replay keyframe interval must be positive"); }
+    }
+
+    void
+    Replay::begin(const Engine& engine)
+    {
+        rows_ = engine.getBoard().getRows();
+        cols_ = engine.getBoard().getCols();
+        seed_ = engine.getSeed();
+        ticks_ = 0;
+        last_ = Engine::Direction(0);
+        changes_.clear();
+        keyframes_.assign(1, engine.saveState().bytes());
+    }
+
+    void
+    Replay::record(const Engine& engine)
+    {
+        assert(!keyframes_.empty());
+        // Stepping never changes the direction, so after the step it is the one the tick used
+        const Engine::Direction direction = engine.getDirection();
+        if (direction != last_) {
+            changes_.push_back({ ticks_, direction });
+            last_ = direction;
+        }
+        if (++ticks_ % keyframeTicks_ == 0) { keyframes_.push_back(engine.saveState().bytes()); }
+    }
+
+    void
+    Replay::seek(Engine& engine, const size_t tick) const
+    {
+        if (keyframes_.empty()) { throw std::logic_error("Replay is empty"); }
+        if (engine.getBoard().getRows() != rows_ || engine.getBoard().getCols() != cols_)
+        { throw std::invalid_argument("Replay board size does not match the engine"); }
+
+        const size_t target = std::min(tick, ticks_);
+        const size_t keyframe = std::min(target / keyframeTicks_, keyframes_.size() - 1);
+        engine.restoreState(keyframes_[keyframe]);
+
+        // The keyframe holds the direction in effect, so only the changes after it are replayed
+        size_t tickNow = keyframe * keyframeTicks_;
+        std::vector<Change>::const_iterator change = std::lower_bound(changes_.begin(), changes_.end(), tickNow,
+            [](const Change& lhv, const size_t rhv) { return lhv.tick < rhv; });
+        for (; tickNow < target; ++tickNow) {
+            if (change != changes_.end() && change->tick == tickNow) { engine.turn((change++)->direction); }
+            engine.step();
+        }
+    }
+
+    Engine::Direction
+    Replay::getDirection(const size_t tick) const
+    {
+        if (changes_.empty()) { throw std::logic_error("Replay is empty"); }
+        std::vector<Change>::const_iterator change = std::upper_bound(changes_.begin(), changes_.end(), tick,
+            [](const size_t lhv, const Change& rhv) { return lhv < rhv.tick; });
+        return change == changes_.begin() ? changes_.front().direction : (change - 1)->direction;
+    }
+
+    void
+    Replay::save(const std::string& path) const
+    {
+        Snapshot::StateWriter writer;
+        writer.put<uint32_t>(REPLAY_KIND);
+        writer.put<uint32_t>(VERSION);
+        writer.put<uint32_t>(Snapshot::BYTE_ORDER_MARK);
+        writer.put<uint64_t>(rows_);
+        writer.put<uint64_t>(cols_);
+        writer.put<uint64_t>(seed_);
+        writer.put<uint64_t>(ticks_);
+        writer.put<uint64_t>(keyframeTicks_);
+        writer.put<uint64_t>(changes_.size());
+        writer.put<uint64_t>(keyframes_.size());
+
+        uint64_t previous = 0;
+        for (const Change& change : changes_) {
+            putVarint(writer, (change.tick - previous) * 4 + directionCode(change.direction));
+            previous = change.tick;
+        }
+        for (const std::string& keyframe : keyframes_) {
+            putVarint(writer, keyframe.size());
+            for (const char byte : keyframe) { writer.put(byte); }
+        }
+
+        std::ofstream file(path, std::ios::binary | std::ios::trunc);
+        file.write(writer.bytes().data(), writer.bytes().size());
+        if (!file) { throw std::runtime_error("Cannot write replay " + path); }
+    }
+
+    void
+    Replay::load(const std::string& path)
+    {
+        const Snapshot::MappedFile file(path);
+        Snapshot::StateReader reader(file.data(), file.size());
+        if (reader.get<uint32_t>() != REPLAY_KIND)            { throw std::runtime_error("Not a snake replay"); }
+        if (reader.get<uint32_t>() != VERSION)                { throw std::runtime_error("Unsupported replay version"); }
+        if (reader.get<uint32_t>() != Snapshot::BYTE_ORDER_MARK) { throw std::runtime_error("Replay was written with another byte order"); }
+
+        const size_t rows = reader.get<uint64_t>();
+        const size_t cols = reader.get<uint64_t>();
+        const uint64_t seed = reader.get<uint64_t>();
+        const size_t ticks = reader.get<uint64_t>();
+        const size_t keyframeTicks = reader.get<uint64_t>();
+        const size_t changeCount = reader.get<uint64_t>();
+        const size_t keyframeCount = reader.get<uint64_t>();
+        if (keyframeTicks == 0 || keyframeCount != ticks / keyframeTicks + 1 || changeCount > ticks || file.size() < changeCount)
+        { throw std::runtime_error("Replay is malformed"); }
+
+        std::vector<Change> changes;
+        changes.reserve(changeCount);
+        uint64_t tick = 0;
+        for (size_t i = 0; i < changeCount; ++i) {
+            const uint64_t value = getVarint(reader);
+            tick += value / 4;
+            if ((i != 0 && value / 4 == 0) || tick >= ticks) { throw std::runtime_error("Replay is malformed"); }
+            changes.push_back({ tick, DIRECTIONS[value % 4] });
+        }
+
+        std::vector<std::string> keyframes(keyframeCount);
+        for (std::string& keyframe : keyframes) {
+            const size_t size = getVarint(reader);
+            if (size > file.size()) { throw std::runtime_error("Replay is truncated"); }
+            keyframe.reserve(size);
+            for (size_t i = 0; i < size; ++i) { keyframe.push_back(reader.get<char>()); }
+        }
+
+        rows_ = rows;
+        cols_ = cols;
+        seed_ = seed;
+        ticks_ = ticks;
+        keyframeTicks_ = keyframeTicks;
+        last_ = changes.empty() ? Engine::Direction(0) : changes.back().direction;
+        changes_.swap(changes);
+        keyframes_.swap(keyframes);
+    }
+}
@@ -0,0 +1,98 @@
+#ifndef __BIT_BOARD_HPP__
+#define __BIT_BOARD_HPP__
+
+#include "../headers/Coordinate.hpp"
+
+#include <cassert>
+#include <cstdint>
+#include <vector>
+
+/// @brief Namespace for the BitBoard class
+/// @details This namespace contains the BitBoard class which represents a 2D plane of bits.
+/// @namespace BitBoard
+namespace SamHovhannisyan::BitBoard
+{
+    /// @brief Class representing a 2D board of one-bit cells
+    /// @details Cells are packed 64 per word, row-major, and every row starts on a word
+    ///          boundary. Padding bits past the last column are always zero, so whole-word
+    ///          operations never have to special-case the right edge. Bulk bitwise operations
+    ///          and population counts use AVX2 when the CPU has it, checked once at start-up,
+    ///          SSE2 on the rest of x86-64 and portable scalar code elsewhere.
+    /// @class BitBoard
+    /// @param rows_ The number of rows in the board
+    /// @param cols_ The number of columns in the board
+    /// @param wordsPerRow_ The number of 64-bit words used by one row
+    /// @param words_ The packed cells
+    class BitBoard
+    {
+    public:
+        typedef Coordinate::Coordinate coordinate;
+        typedef size_t size_type;
+        typedef uint64_t word_type;
+
+        static const size_type WORD_BITS = 64;
+
+    public:
+        /// @brief Constructor
+        /// @details Initializes a board of the given size with every bit cleared.
+        BitBoard(const size_type rows = 0, const size_type cols = 0);
+
+        size_type getRows() const { return rows_; }
+        size_type getCols() const { return cols_; }
+        size_type getWordsPerRow() const { return wordsPerRow_; }
+        word_type* data() { return words_.data(); }
+        const word_type* data() const { return words_.data(); }
+        word_type* row(const size_type y) { assert(y < rows_); return words_.data() + y * wordsPerRow_; }
+        const word_type* row(const size_type y) const { assert(y < rows_); return words_.data() + y * wordsPerRow_; }
+
+        /// @brief Single cell access
+        bool operator()(const coordinate& coord) const;
+        void setValue(const coordinate& coord, const bool value);
+        void set(const coordinate& coord);
+        void reset(const coordinate& coord);
+        void flip(const coordinate& coord);
+
+        /// @brief Whole board operations
+        /// @details count() is the number of set cells; any() and none() stop at the first set word.
+        size_type count() const;
+        bool any() const;
+        bool none() const { return !any(); }
+        void clear();
+
+        /// @brief Word-parallel bitwise operations
+        /// @details Both operands must have the same dimensions.
+        BitBoard& operator&=(const BitBoard& rhv);
+        BitBoard& operator|=(const BitBoard& rhv);
+        BitBoard& operator^=(const BitBoard& rhv);
+        BitBoard& andNot(const BitBoard& rhv);
+        BitBoard operator~() const;
+        bool operator==(const BitBoard& rhv) const;
+        bool operator!=(const BitBoard& rhv) const { return !(*this == rhv); }
+
+        /// @brief Shift every cell by (dx, dy)
+        /// @details Cells moved past an edge are dropped and vacated cells are cleared.
+        ///          Positive dx moves cells toward higher columns, positive dy toward higher rows.
+        BitBoard shifted(const int dx, const int dy) const;
+
+        /// @brief Count the set 8-neighbours of every cell
+        /// @details Sums the eight shifted planes with bit-sliced adders, 64 cells per word
+        ///          operation, and writes one count (0..8) per cell to counts, row-major,
+        ///          getRows() * getCols() bytes.
+        void neighbourCounts(uint8_t* counts) const;
+
+    private:
+        void maskPadding();
+
+    private:
+        size_type rows_;
+        size_type cols_;
+        size_type wordsPerRow_;
+        std::vector<word_type> words_;
+    };
+
+    BitBoard operator&(BitBoard lhv, const BitBoard& rhv);
+    BitBoard operator|(BitBoard lhv, const BitBoard& rhv);
+    BitBoard operator^(BitBoard lhv, const BitBoard& rhv);
+}
+
+#endif // __BIT_BOARD_HPP__
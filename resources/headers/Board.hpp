@@ -3,6 +3,7 @@
 #define __BOARD_HPP__ 
 
 #include "../headers/Coordinate.hpp"
+#include "../headers/BoardView.hpp"
 
 #include <iostream>
 #include <vector>
@@ -19,13 +20,14 @@ namespace SamHovhannisyan
 namespace Board
 {
     /// @brief Class representing a 2D board
-    /// @details This class contains a 2D vector to represent the board, and provides methods to
-    ///          get and set the size of the board, get the board, and access elements using
-    ///          coordinates. It also provides a constructor, copy constructor, and assignment operator.
+    /// @details This class stores the cells in one contiguous row-major buffer, and provides methods to
+    ///          get and set the size of the board, view the board, and access elements using
+    ///          coordinates, linear indices, row views or iterators. It also provides a constructor,
+    ///          copy constructor, and assignment operator.
     /// @class Board
     /// @tparam T The type of the elements in the board
     /// @param size_type The size type for the board
-    /// @param board_ The 2D vector representing the board
+    /// @param board_ The row-major buffer holding rows_ * cols_ cells
     /// @param rows_ The number of rows in the board
     /// @param cols_ The number of columns in the board
     /// @param coordinate The Coordinate class representing the coordinates of the board
@@ -37,6 +39,12 @@ namespace Board
         typedef Coordinate::Coordinate coordinate;
         typedef typename coordinate::coordinate_type coordinate_type;
         typedef size_t size_type;
+        typedef T value_type;
+        typedef T* iterator;
+        typedef const T* const_iterator;
+        typedef Row<T> row_type;
+        typedef Row<const T> const_row_type;
+        typedef BoardView<T> view_type;
 
     public:
         /// @brief Constructor
@@ -55,12 +63,37 @@ namespace Board
         /// @details This operator allows for the assignment of one Board object to another.
         const Board& operator=(const Board& rhv);
         
-        std::vector<std::vector<T>> getBoard() const;
+        /// @brief Get a read-only view of the board
+        /// @details The view does not copy the cells; it is invalidated by resizing the board.
+        view_type getBoard() const;
         size_type getRows() const;
         size_type getCols() const;
+        size_type size() const;
         
+        /// @brief Resize the board
+        /// @details Cells inside both the old and the new bounds keep their values,
+        ///          new cells are default constructed.
         void setRows(const size_type rows);
         void setCols(const size_type cols);
+        void resize(const size_type rows, const size_type cols);
+
+        /// @brief Linear access
+        /// @details Cells are stored row-major, index = y * getCols() + x.
+        size_type indexOf(const coordinate& coord) const;
+        coordinate coordinateOf(const size_type index) const;
+        T& operator[](const size_type index);
+        const T& operator[](const size_type index) const;
+        T* data();
+        const T* data() const;
+
+        /// @brief Row and cell iteration
+        /// @details Rows are span-style views into the board; iterators visit cells in memory order.
+        row_type row(const size_type y);
+        const_row_type row(const size_type y) const;
+        iterator begin();
+        iterator end();
+        const_iterator begin() const;
+        const_iterator end() const;
         
         /// @brief Access operators
         /// @details This operators allow for the access of elements in the board using coordinates.
@@ -74,11 +107,32 @@ namespace Board
         /// @param coord The coordinates of the element to set
         /// @param value The value to set at the given coordinates
         void setValue(const coordinate& coord, const T& value);
+        void fill(const T& value);
+
+        /// @brief Dirty cell tracking
+        /// @details When enabled, every cell handed out for writing (non-const operator(),
+        ///          operator[] and setValue) is recorded once until clearDirty(). Bulk writes
+        ///          through fill, resize, row views or iterators mark the whole board dirty.
+        ///          Renderers use this to repaint only the cells that changed.
+        void setDirtyTracking(const bool enabled);
+        bool isDirtyTracking() const;
+        void markDirty(const coordinate& coord);
+        void markAllDirty();
+        bool isAllDirty() const;
+        const std::vector<size_type>& getDirty() const;
+        void clearDirty();
         
     private:
         size_type rows_;
         size_type cols_;
-        std::vector<std::vector<T>> board_;
+        std::vector<T> board_;
+        bool tracking_;
+        bool allDirty_;
+        std::vector<size_type> dirty_;
+        std::vector<bool> dirtyMask_;
+
+    private:
+        void touch(const size_type index);
     };
 }
 }
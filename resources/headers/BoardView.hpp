@@ -0,0 +1,79 @@
+#ifndef __BOARD_VIEW_HPP__
+#define __BOARD_VIEW_HPP__
+
+#include "../headers/Coordinate.hpp"
+
+#include <cassert>
+#include <cstddef>
+
+namespace SamHovhannisyan::Board
+{
+    /// @brief Non-owning view of one row of a board
+    /// @details Span-style view over a contiguous run of cells. It stays valid as long as
+    ///          the board it was taken from is not resized or destroyed.
+    /// @class Row
+    /// @tparam T The type of the elements in the row (const-qualified for read-only rows)
+    template <typename T>
+    class Row
+    {
+    public:
+        typedef size_t size_type;
+        typedef T value_type;
+        typedef T* iterator;
+
+    public:
+        Row(T* data = nullptr, const size_type size = 0) : data_(data), size_(size) {}
+
+        T& operator[](const size_type x) const { assert(x < size_); return data_[x]; }
+        T* data() const { return data_; }
+        size_type size() const { return size_; }
+        iterator begin() const { return data_; }
+        iterator end() const { return data_ + size_; }
+
+    private:
+        T* data_;
+        size_type size_;
+    };
+
+    /// @brief Non-owning read-only view of a whole board
+    /// @details Replaces the deep copy that Board::getBoard used to return. Cells are stored
+    ///          row-major, so iterating the view visits them in memory order.
+    /// @class BoardView
+    /// @tparam T The type of the elements in the board
+    template <typename T>
+    class BoardView
+    {
+    public:
+        typedef Coordinate::Coordinate coordinate;
+        typedef size_t size_type;
+        typedef const T* const_iterator;
+
+    public:
+        BoardView(const T* data = nullptr, const size_type rows = 0, const size_type cols = 0)
+            : data_(data), rows_(rows), cols_(cols) {}
+
+        size_type getRows() const { return rows_; }
+        size_type getCols() const { return cols_; }
+        size_type size() const { return rows_ * cols_; }
+        const T* data() const { return data_; }
+
+        const T& operator()(const coordinate& coord) const
+        {
+            assert(coord.y < rows_);
+            assert(coord.x < cols_);
+            return data_[coord.y * cols_ + coord.x];
+        }
+        const T& operator[](const size_type index) const { assert(index < size()); return data_[index]; }
+        Row<const T> row(const size_type y) const { assert(y < rows_); return Row<const T>(data_ + y * cols_, cols_); }
+
+        const_iterator begin() const { return data_; }
+        const_iterator end() const { return data_ + size(); }
+
+    private:
+        const T* data_;
+        size_type rows_;
+        size_type cols_;
+    };
+}
+
+#endif // __BOARD_VIEW_HPP__
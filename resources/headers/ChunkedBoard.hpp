@@ -0,0 +1,119 @@
+#ifndef __CHUNKED_BOARD_HPP__
+#define __CHUNKED_BOARD_HPP__
+
+#include "../headers/Coordinate.hpp"
+
+#include <array>
+#include <cassert>
+#include <cstdint>
+#include <functional>
+#include <list>
+#include <memory>
+#include <unordered_map>
+
+namespace SamHovhannisyan::Board
+{
+    /// @brief Class representing a sparse 2D board made of fixed-size tiles
+    /// @details The board is split into TileSize x TileSize tiles which are allocated lazily on
+    ///          the first write. Reads of tiles that were never written are served from one shared
+    ///          default value, so memory grows with the region actually played instead of with
+    ///          rows * cols. Resident tiles are kept in LRU order; when a capacity is set, the least
+    ///          recently used tile is handed to the evictor and dropped, and the loader is asked to
+    ///          rebuild a tile the next time it is touched. With a capacity but no evictor, writes
+    ///          to an evicted tile are lost: it reads back as the loader rebuilds it, or as default.
+    ///          References returned by the access operators stay valid until the next access that
+    ///          may allocate or evict a tile.
+    /// @class ChunkedBoard
+    /// @tparam T The type of the elements in the board
+    /// @tparam TileSize The width and height of one tile
+    /// @param rows_ The number of rows in the board
+    /// @param cols_ The number of columns in the board
+    /// @param default_ The value of every cell that was never written
+    /// @param capacity_ The maximum number of resident tiles (0 means unlimited)
+    template <typename T, size_t TileSize = 64>
+    class ChunkedBoard
+    {
+    public:
+        typedef Coordinate::Coordinate coordinate;
+        typedef typename coordinate::coordinate_type coordinate_type;
+        typedef size_t size_type;
+        typedef T value_type;
+        typedef uint64_t tile_key;
+
+        static constexpr size_type TILE_SIZE = TileSize;
+
+        struct Tile
+        {
+            std::array<T, TileSize * TileSize> cells;
+        };
+
+        /// @brief Tile callbacks
+        /// @details The loader fills a tile that is not resident and returns false if the tile has
+        ///          nothing but default cells. The evictor receives a tile right before it is dropped.
+        typedef std::function<bool(const tile_key, Tile&)> loader_type;
+        typedef std::function<void(const tile_key, const Tile&)> evictor_type;
+
+    public:
+        /// @brief Constructor
+        /// @details No tile is allocated until the first write.
+        ChunkedBoard(const size_type rows = 0, const size_type cols = 0, const T& value = T(), const size_type capacity = 0);
+        ChunkedBoard(const ChunkedBoard& rhv) = delete;
+        const ChunkedBoard& operator=(const ChunkedBoard& rhv) = delete;
+
+        size_type getRows() const { return rows_; }
+        size_type getCols() const { return cols_; }
+        const T& getDefault() const { return default_; }
+        size_type getCapacity() const { return capacity_; }
+        size_type getTileCount() const { return tiles_.size(); }
+        void setCapacity(const size_type capacity);
+        void setTileLoader(const loader_type& loader) { loader_ = loader; }
+        void setTileEvictor(const evictor_type& evictor) { evictor_ = evictor; }
+
+        /// @brief Tile addressing
+        /// @details A key packs the tile row in the high and the tile column in the low 32 bits.
+        static tile_key keyOf(const coordinate& coord);
+        static coordinate originOf(const tile_key key);
+        bool isResident(const coordinate& coord) const;
+
+        /// @brief Access operators
+        /// @details The const operator never allocates a tile the loader reports as empty;
+        ///          the non-const one allocates the tile for writing.
+        T& operator()(const coordinate& coord);
+        const T& operator()(const coordinate& coord) const;
+        void setValue(const coordinate& coord, const T& value);
+
+        /// @brief Drop every tile
+        /// @details Resident tiles are passed to the evictor first.
+        void clear();
+
+    private:
+        struct Entry
+        {
+            std::unique_ptr<Tile> tile;
+            typename std::list<tile_key>::iterator position;
+        };
+
+    private:
+        Tile* findTile(const tile_key key, const bool allocate) const;
+        void evictOldest() const;
+        static size_type cellOf(const coordinate& coord);
+
+    private:
+        size_type rows_;
+        size_type cols_;
+        T default_;
+        size_type capacity_;
+        loader_type loader_;
+        evictor_type evictor_;
+        mutable std::unordered_map<tile_key, Entry> tiles_;
+        mutable std::list<tile_key> lru_;
+        mutable tile_key lastKey_;
+        mutable Tile* lastTile_;
+        /// @brief The last evicted or unused tile, kept for the next miss
+        mutable std::unique_ptr<Tile> spare_;
+    };
+}
+
+#include "../templates/ChunkedBoard.cpp"
+
+#endif // __CHUNKED_BOARD_HPP__
@@ -23,23 +23,23 @@ namespace SamHovhannisyan::Coordinate
         coordinate_type y;
         /// @brief Default constructor
         /// @details Initializes the x and y coordinates to 0.
-        Coordinate(const coordinate_type x = 0, const coordinate_type y = 0) : x(x), y(y) {}
+        constexpr Coordinate(const coordinate_type x = 0, const coordinate_type y = 0) : x(x), y(y) {}
         /// @brief Copy constructor
         /// @details Initializes the x and y coordinates to the values of the right-hand value.
         /// @param rhv The right-hand value for copy constructor
-        Coordinate(const Coordinate& rhv) : x(rhv.x), y(rhv.y) {}
+        constexpr Coordinate(const Coordinate& rhv) : x(rhv.x), y(rhv.y) {}
         /// @brief Assignment operator
         /// @details Assigns the x and y coordinates of the right-hand value to this object.
         /// @param rhv The right-hand value for assignment operator
-        const Coordinate& operator=(const Coordinate& rhv) { x = rhv.x; y = rhv.y; return *this; }
+        constexpr const Coordinate& operator=(const Coordinate& rhv) { x = rhv.x; y = rhv.y; return *this; }
         /// @brief Equality operator
         /// @details Compares the x and y coordinates of this object with the right-hand value.
         /// @param rhv The right-hand value for equality operator
-        bool operator==(const Coordinate& rhv) const { return x == rhv.x && y == rhv.y; }
+        constexpr bool operator==(const Coordinate& rhv) const { return x == rhv.x && y == rhv.y; }
         /// @brief Inequality operator
         /// @details Compares the x and y coordinates of this object with the right-hand value.
         /// @param rhv The right-hand value for inequality operator
-        bool operator!=(const Coordinate& rhv) const { return !(*this == rhv); }
+        constexpr bool operator!=(const Coordinate& rhv) const { return !(*this == rhv); }
     };
 }
 
@@ -0,0 +1,54 @@
+#ifndef __HISTOGRAM_HPP__
+#define __HISTOGRAM_HPP__
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+/// @brief Namespace for the Histogram class
+/// @details This namespace contains the fixed-size histogram used for latency measurements.
+/// @namespace Histogram
+namespace SamHovhannisyan::Histogram
+{
+    /// @brief Log-linear histogram of non-negative integers, such as latencies in nanoseconds
+    /// @details Values below 16 get a bucket each; above that every power of two is split into
+    ///          8 equal buckets, so a percentile is reported within 12.5% of the true value over
+    ///          the whole 64-bit range with a fixed array of counters. record() is O(1) and never
+    ///          allocates, so it can sit on a hot path.
+    /// @class Histogram
+    /// @param buckets_ The number of values recorded in each bucket
+    class Histogram
+    {
+    public:
+        static constexpr size_t SUB_BUCKET_BITS = 3;
+        static constexpr size_t SUB_BUCKETS = size_t(1) << SUB_BUCKET_BITS;
+        static constexpr size_t BUCKETS = (64 - SUB_BUCKET_BITS + 1) * SUB_BUCKETS;
+
+    public:
+        Histogram();
+
+        void record(const uint64_t value);
+        void clear();
+
+        size_t count() const { return count_; }
+        uint64_t min() const { return count_ == 0 ? 0 : min_; }
+        uint64_t max() const { return max_; }
+        double mean() const { return count_ == 0 ? 0.0 : double(total_) / count_; }
+        /// @brief The smallest recorded bound at or below which percent % of the values lie
+        /// @details Reported as the upper edge of the bucket, capped at max().
+        uint64_t percentile(const double percent) const;
+
+        /// @brief Bucket layout
+        static size_t bucketOf(const uint64_t value);
+        static uint64_t lowerBound(const size_t bucket);
+
+    private:
+        std::array<uint64_t, BUCKETS> buckets_;
+        size_t count_;
+        uint64_t total_;
+        uint64_t min_;
+        uint64_t max_;
+    };
+}
+
+#endif // __HISTOGRAM_HPP__
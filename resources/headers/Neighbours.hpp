@@ -0,0 +1,37 @@
+#ifndef __NEIGHBOURS_HPP__
+#define __NEIGHBOURS_HPP__
+
+/// @brief Namespace for the compile-time neighbour offsets
+/// @details Tables of (dx, dy) steps shared by the games, so neighbour loops have constant
+///          trip counts and never allocate direction vectors at run time.
+/// @namespace Neighbours
+namespace SamHovhannisyan::Neighbours
+{
+    struct Offset
+    {
+        int dx;
+        int dy;
+    };
+
+    constexpr Offset DIAGONAL[4] = {
+        { 1,  1},  // Down-right
+        { 1, -1},  // Up-right
+        {-1,  1},  // Down-left
+        {-1, -1}   // Up-left
+    };
+
+    constexpr Offset ORTHOGONAL[4] = {
+        { 0, -1},  // Up
+        { 0,  1},  // Down
+        {-1,  0},  // Left
+        { 1,  0}   // Right
+    };
+
+    constexpr Offset SURROUNDING[8] = {
+        {-1, -1}, { 0, -1}, { 1, -1},
+        {-1,  0},           { 1,  0},
+        {-1,  1}, { 0,  1}, { 1,  1}
+    };
+}
+
+#endif // __NEIGHBOURS_HPP__
@@ -9,11 +9,11 @@ namespace SamHovhannisyan::Piece
         T value;
         bool hasMoved;
 
-        Piece(const T& val = T(), bool hasMoved = false) : value(val), hasMoved(hasMoved) {}
-        Piece(const Piece& rhv) : value(rhv.value), hasMoved(rhv.hasMoved) {}
-        const Piece& operator=(const Piece& rhv) { value = rhv.value; hasMoved = rhv.hasMoved; return *this; }
-        bool operator==(const Piece& rhv) const { return value == rhv.value; }
-        bool operator!=(const Piece& rhv) const { return !(*this == rhv); }
+        constexpr Piece(const T& val = T(), bool hasMoved = false) : value(val), hasMoved(hasMoved) {}
+        constexpr Piece(const Piece& rhv) = default;
+        constexpr Piece& operator=(const Piece& rhv) = default;
+        constexpr bool operator==(const Piece& rhv) const { return value == rhv.value; }
+        constexpr bool operator!=(const Piece& rhv) const { return !(*this == rhv); }
     };
 }
 
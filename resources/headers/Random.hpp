@@ -0,0 +1,51 @@
+#ifndef __RANDOM_HPP__
+#define __RANDOM_HPP__
+
+#include <cstdint>
+
+/// @brief Namespace for the seeded random number generators
+/// @details This namespace contains the generator the engines use wherever a game must be
+///          reproducible from its seed.
+/// @namespace Random
+namespace SamHovhannisyan::Random
+{
+    /// @brief SplitMix64 generator
+    /// @details One 64-bit word of state, so it is cheap to seed, copy and store in a snapshot,
+    ///          and every seed (0 included) gives a full-period, well mixed stream. Satisfies
+    ///          UniformRandomBitGenerator, so it also plugs into the <random> distributions.
+    /// @class SplitMix64
+    /// @param state_ The generator state; the whole stream follows from it
+    class SplitMix64
+    {
+    public:
+        typedef uint64_t result_type;
+
+    public:
+        explicit SplitMix64(const uint64_t seed = 0) : state_(seed) {}
+
+        static constexpr result_type min() { return 0; }
+        static constexpr result_type max() { return UINT64_MAX; }
+
+        result_type operator()()
+        {
+            uint64_t z = (state_ += 0x9E3779B97F4A7C15ull);
+            z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ull;
+            z = (z ^ (z >> 27)) * 0x94D049BB133111EBull;
+            return z ^ (z >> 31);
+        }
+
+        /// @brief Uniform value in 0 .. bound - 1, by multiply-shift instead of a division
+        uint64_t below(const uint64_t bound) { return uint64_t((unsigned __int128)(*this)() * bound >> 64); }
+
+        uint64_t getState() const { return state_; }
+        void setState(const uint64_t state) { state_ = state; }
+
+    private:
+        uint64_t state_;
+    };
+
+    /// @brief A fresh seed from std::random_device mixed with the clock
+    uint64_t randomSeed();
+}
+
+#endif // __RANDOM_HPP__
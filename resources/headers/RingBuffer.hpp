@@ -0,0 +1,63 @@
+#ifndef __RING_BUFFER_HPP__
+#define __RING_BUFFER_HPP__
+
+#include <cassert>
+#include <cstddef>
+#include <vector>
+
+/// @brief Namespace for the RingBuffer class
+/// @details This namespace contains the RingBuffer class which represents a fixed-capacity double-ended queue.
+/// @namespace RingBuffer
+namespace SamHovhannisyan::RingBuffer
+{
+    /// @brief Fixed-capacity double-ended queue
+    /// @details Elements live in one buffer allocated up front and the ends wrap around it, so
+    ///          pushing and popping at either end is O(1) and never allocates. Index 0 is the
+    ///          front. Pushing onto a full buffer is a precondition violation.
+    /// @class RingBuffer
+    /// @tparam T The type of the elements
+    /// @param data_ The storage, capacity() elements long
+    /// @param head_ The storage index of the front element
+    /// @param size_ The number of elements
+    template <typename T>
+    class RingBuffer
+    {
+    public:
+        typedef size_t size_type;
+        typedef T value_type;
+
+    public:
+        RingBuffer(const size_type capacity = 0);
+
+        size_type capacity() const { return data_.size(); }
+        size_type size() const { return size_; }
+        bool empty() const { return size_ == 0; }
+        bool full() const { return size_ == data_.size(); }
+
+        void push_front(const T& value);
+        void push_back(const T& value);
+        void pop_front();
+        void pop_back();
+        void clear() { head_ = 0; size_ = 0; }
+
+        T& front() { assert(!empty()); return data_[head_]; }
+        const T& front() const { assert(!empty()); return data_[head_]; }
+        T& back() { assert(!empty()); return data_[wrap(head_ + size_ - 1)]; }
+        const T& back() const { assert(!empty()); return data_[wrap(head_ + size_ - 1)]; }
+        T& operator[](const size_type index) { assert(index < size_); return data_[wrap(head_ + index)]; }
+        const T& operator[](const size_type index) const { assert(index < size_); return data_[wrap(head_ + index)]; }
+
+    private:
+        /// @brief Map head_ + offset (offset < capacity) back into the storage
+        size_type wrap(const size_type index) const { return index >= data_.size() ? index - data_.size() : index; }
+
+    private:
+        std::vector<T> data_;
+        size_type head_;
+        size_type size_;
+    };
+}
+
+#include "../templates/RingBuffer.cpp"
+
+#endif // __RING_BUFFER_HPP__
@@ -0,0 +1,80 @@
+#ifndef __SCHEDULER_HPP__
+#define __SCHEDULER_HPP__
+
+#include <cstddef>
+#include <cstdint>
+#include <ctime>
+
+/// @brief Namespace for the Scheduler class
+/// @details This namespace contains the fixed-timestep scheduler used by the real-time game loops.
+/// @namespace Scheduler
+namespace SamHovhannisyan::Scheduler
+{
+    /// @brief Tick timing statistics
+    /// @details Jitter is how late the loop woke up after a deadline it slept to. An overrun
+    ///          is a deadline that had already passed before the loop got to sleep, because the
+    ///          previous tick and frame took longer than the period.
+    struct Statistics
+    {
+        size_t ticks = 0;
+        size_t sleeps = 0;
+        size_t renders = 0;
+        size_t skippedRenders = 0;
+        size_t overruns = 0;
+        size_t droppedTicks = 0;
+        int64_t totalJitter = 0;
+        int64_t maxJitter = 0;
+        int64_t maxOverrun = 0;
+
+        /// @brief Mean wake-up lateness in nanoseconds
+        double meanJitter() const { return sleeps == 0 ? 0.0 : double(totalJitter) / sleeps; }
+    };
+
+    /// @brief The CLOCK_MONOTONIC time in nanoseconds, the clock every deadline is on
+    int64_t now();
+
+    /// @brief Fixed-timestep loop scheduler
+    /// @details Deadlines are absolute points on CLOCK_MONOTONIC, each one period after the
+    ///          previous deadline rather than after the previous wake-up, so the time spent in
+    ///          a tick never stretches the period and errors do not accumulate. When the loop
+    ///          falls behind, wait() returns immediately with every tick that is due (up to
+    ///          MAX_CATCH_UP; older ones are dropped) and shouldRender() turns false until the
+    ///          loop is back on schedule, so the game keeps its speed and frames are skipped.
+    /// @class Scheduler
+    /// @param period_ The tick period in nanoseconds
+    /// @param next_ The next tick deadline
+    /// @param statistics_ The timing statistics collected so far
+    class Scheduler
+    {
+    public:
+        static constexpr size_t MAX_CATCH_UP = 5;
+
+    public:
+        /// @brief Constructor
+        /// @details The first deadline is one period after construction or restart().
+        Scheduler(const int64_t periodNanoseconds);
+
+        /// @brief Change the period; it applies from the deadline after the next one
+        void setPeriod(const int64_t periodNanoseconds) { period_ = periodNanoseconds; }
+        int64_t getPeriod() const { return period_; }
+
+        /// @brief Restart the schedule from now
+        void restart();
+        /// @brief Sleep until the next deadline
+        /// @return The number of ticks to run, at least 1
+        size_t wait();
+        /// @brief Whether there is time left for a frame before the next deadline
+        bool shouldRender() const;
+        /// @brief Record whether the frame for this round was drawn or skipped
+        void rendered(const bool drawn);
+
+        const Statistics& getStatistics() const { return statistics_; }
+
+    private:
+        int64_t period_;
+        timespec next_;
+        Statistics statistics_;
+    };
+}
+
+#endif // __SCHEDULER_HPP__
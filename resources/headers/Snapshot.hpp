@@ -0,0 +1,221 @@
+#ifndef __SNAPSHOT_HPP__
+#define __SNAPSHOT_HPP__
+
+#include "../headers/BoardView.hpp"
+
+#include <atomic>
+#include <cstdint>
+#include <cstring>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+/// @brief Namespace for the binary snapshot format
+/// @details A snapshot file is a fixed Header, the game state block, and the board cells stored
+///          raw and row-major at a 64-byte aligned offset. Loading memory-maps the file and
+///          hands out a BoardView over the cells in place, without parsing or per-cell work.
+///          Files use the byte order and cell layout of the machine that wrote them; the header
+///          records both and foreign files are rejected.
+/// @namespace Snapshot
+namespace SamHovhannisyan::Snapshot
+{
+    static const char MAGIC[4] = {'S', 'H', 'S', 'N'};
+    static const uint32_t VERSION = 1;
+    static const uint32_t BYTE_ORDER_MARK = 0x01020304;
+    static const uint64_t CELLS_ALIGNMENT = 64;
+
+    /// @brief Tag a snapshot with the game that wrote it
+    constexpr uint32_t
+    kindOf(const char (&name)[5])
+    {
+        return uint32_t(uint8_t(name[0])) | uint32_t(uint8_t(name[1])) << 8 |
+               uint32_t(uint8_t(name[2])) << 16 | uint32_t(uint8_t(name[3])) << 24;
+    }
+
+    struct Header
+    {
+        char magic[4];
+        uint32_t version;
+        uint32_t byteOrder;
+        uint32_t kind;
+        uint64_t cellSize;
+        uint64_t rows;
+        uint64_t cols;
+        uint64_t stateOffset;
+        uint64_t stateSize;
+        uint64_t cellsOffset;
+    };
+
+    /// @brief Cell types that may be written and mapped as raw bytes
+    /// @details std::pair only counts as non-trivial because of its declared assignment
+    ///          operator; its layout is plain when both members are.
+    template <typename T>
+    struct is_raw_cell : std::is_trivially_copyable<T> {};
+
+    template <typename A, typename B>
+    struct is_raw_cell<std::pair<A, B>> : std::integral_constant<bool, is_raw_cell<A>::value && is_raw_cell<B>::value> {};
+
+    /// @brief Builder for the game state block
+    class StateWriter
+    {
+    public:
+        template <typename T>
+        void put(const T& value)
+        {
+            static_assert(is_raw_cell<T>::value, "state values are stored as raw bytes");
+            bytes_.append(reinterpret_cast<const char*>(&value), sizeof(T));
+        }
+
+        const std::string& bytes() const { return bytes_; }
+
+    private:
+        std::string bytes_;
+    };
+
+    /// @brief Reader for the game state block
+    /// @details Throws std::runtime_error when a read runs past the end of the block.
+    class StateReader
+    {
+    public:
+        StateReader(const char* data = nullptr, const size_t size = 0) : data_(data), size_(size), position_(0) {}
+
+        template <typename T>
+        T get()
+        {
+            static_assert(is_raw_cell<T>::value, "state values are stored as raw bytes");
+            if (position_ + sizeof(T) > size_) { throw std::runtime_error("Snapshot state is truncated"); }
+            T value;
+            std::memcpy(static_cast<void*>(&value), data_ + position_, sizeof(T));
+            position_ += sizeof(T);
+            return value;
+        }
+
+    private:
+        const char* data_;
+        size_t size_;
+        size_t position_;
+    };
+
+    /// @brief Read-only memory mapping of a whole file
+    /// @class MappedFile
+    class MappedFile
+    {
+    public:
+        explicit MappedFile(const std::string& path);
+        MappedFile(const MappedFile& rhv) = delete;
+        const MappedFile& operator=(const MappedFile& rhv) = delete;
+        ~MappedFile();
+
+        const char* data() const { return data_; }
+        size_t size() const { return size_; }
+
+    private:
+        const char* data_;
+        size_t size_;
+    };
+
+    /// @brief Validate a mapped snapshot and return its header
+    /// @details Throws std::runtime_error if the file is not a snapshot of the given kind and cell size.
+    const Header& validate(const MappedFile& file, const uint32_t kind, const uint64_t cellSize);
+
+    /// @brief Board cells mapped in place from a snapshot file
+    /// @class MappedBoard
+    /// @tparam T The type of the elements in the board
+    template <typename T>
+    class MappedBoard
+    {
+        static_assert(is_raw_cell<T>::value, "snapshot cells are mapped as raw bytes");
+
+    public:
+        MappedBoard(const std::string& path, const uint32_t kind)
+            : file_(path)
+            , header_(validate(file_, kind, sizeof(T)))
+        {}
+
+        Board::BoardView<T> getBoard() const
+        {
+            return Board::BoardView<T>(reinterpret_cast<const T*>(file_.data() + header_.cellsOffset), header_.rows, header_.cols);
+        }
+
+        StateReader getState() const { return StateReader(file_.data() + header_.stateOffset, header_.stateSize); }
+
+    private:
+        MappedFile file_;
+        const Header& header_;
+    };
+
+    /// @brief Write a snapshot file
+    /// @details The file is written next to path and renamed over it, so a reader never sees a
+    ///          partial snapshot. Throws std::runtime_error on I/O failure.
+    void writeFile(const std::string& path, const uint32_t kind, const uint64_t cellSize, const uint64_t rows,
+                   const uint64_t cols, const std::string& state, const char* cells);
+
+    template <typename BoardType>
+    void
+    save(const std::string& path, const uint32_t kind, const BoardType& board, const StateWriter& state)
+    {
+        typedef typename BoardType::value_type value_type;
+        static_assert(is_raw_cell<value_type>::value, "snapshot cells are written as raw bytes");
+        writeFile(path, kind, sizeof(value_type), board.getRows(), board.getCols(), state.bytes(),
+                  reinterpret_cast<const char*>(board.data()));
+    }
+
+    /// @brief Copy the cells of a snapshot into a board of the same size
+    template <typename BoardType>
+    void
+    restore(const Board::BoardView<typename BoardType::value_type>& view, BoardType& board)
+    {
+        if (view.getRows() != board.getRows() || view.getCols() != board.getCols())
+        { throw std::runtime_error("Snapshot board size does not match"); }
+        std::memcpy(static_cast<void*>(board.data()), view.data(), view.size() * sizeof(typename BoardType::value_type));
+    }
+
+    /// @brief Background snapshot writer
+    /// @details write() copies the cells and the state in one memcpy and returns; the file is
+    ///          written by a worker thread while the game loop keeps running. A write requested
+    ///          while the previous one is still in flight is skipped.
+    /// @class Writer
+    class Writer
+    {
+    public:
+        Writer() : busy_(false), failed_(false) {}
+        Writer(const Writer& rhv) = delete;
+        const Writer& operator=(const Writer& rhv) = delete;
+        ~Writer();
+
+        template <typename BoardType>
+        bool write(const std::string& path, const uint32_t kind, const BoardType& board, const StateWriter& state)
+        {
+            typedef typename BoardType::value_type value_type;
+            static_assert(is_raw_cell<value_type>::value, "snapshot cells are written as raw bytes");
+            if (isBusy()) { return false; }
+            join();
+            cells_.resize(board.getRows() * board.getCols() * sizeof(value_type));
+            std::memcpy(cells_.data(), static_cast<const void*>(board.data()), cells_.size());
+            start(path, kind, sizeof(value_type), board.getRows(), board.getCols(), state.bytes());
+            return true;
+        }
+
+        bool isBusy() const;
+        /// @brief Block until the last write finished
+        /// @details Returns false if the last write failed.
+        bool wait();
+
+    private:
+        void start(const std::string& path, const uint32_t kind, const uint64_t cellSize,
+                   const uint64_t rows, const uint64_t cols, const std::string& state);
+        void join();
+
+    private:
+        std::thread thread_;
+        std::vector<char> cells_;
+        std::string state_;
+        std::atomic<bool> busy_;
+        std::atomic<bool> failed_;
+    };
+}
+
+#endif // __SNAPSHOT_HPP__
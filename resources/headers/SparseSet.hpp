@@ -0,0 +1,77 @@
+#ifndef __SPARSE_SET_HPP__
+#define __SPARSE_SET_HPP__
+
+#include <cassert>
+#include <cstddef>
+#include <vector>
+
+/// @brief Namespace for the SparseSet class
+/// @details This namespace contains the SparseSet class which represents a set of small integers.
+/// @namespace SparseSet
+namespace SamHovhannisyan::SparseSet
+{
+    /// @brief Set of indices below a fixed universe size with O(1) everything
+    /// @details Members are packed densely in dense_ and position_ maps each index to its slot,
+    ///          so insert, erase (swap with the last member), membership and picking the k-th
+    ///          member are all constant time and never allocate after construction. Iteration
+    ///          order is arbitrary. Typical use is the set of free cells of a board, sampled
+    ///          uniformly with operator[](random % size()).
+    /// @class SparseSet
+    /// @param dense_ The members, packed at the front
+    /// @param position_ The slot of every index in dense_, valid only for members
+    /// @param size_ The number of members
+    class SparseSet
+    {
+    public:
+        typedef size_t size_type;
+        typedef const size_type* const_iterator;
+
+    public:
+        /// @brief Constructor
+        /// @details Creates an empty set able to hold the indices 0 .. universe - 1.
+        SparseSet(const size_type universe = 0);
+
+        size_type universe() const { return dense_.size(); }
+        size_type size() const { return size_; }
+        bool empty() const { return size_ == 0; }
+
+        bool contains(const size_type index) const
+        {
+            assert(index < universe());
+            return position_[index] < size_ && dense_[position_[index]] == index;
+        }
+
+        /// @brief Add an index; adding a member is a no-op
+        void insert(const size_type index)
+        {
+            if (contains(index)) { return; }
+            dense_[size_] = index;
+            position_[index] = size_++;
+        }
+
+        /// @brief Remove an index; removing a non-member is a no-op
+        void erase(const size_type index)
+        {
+            if (!contains(index)) { return; }
+            const size_type last = dense_[--size_];
+            dense_[position_[index]] = last;
+            position_[last] = position_[index];
+        }
+
+        /// @brief The k-th member in the current (arbitrary) order
+        size_type operator[](const size_type k) const { assert(k < size_); return dense_[k]; }
+        const_iterator begin() const { return dense_.data(); }
+        const_iterator end() const { return dense_.data() + size_; }
+
+        /// @brief Make every index of the universe a member
+        void fill();
+        void clear() { size_ = 0; }
+
+    private:
+        std::vector<size_type> dense_;
+        std::vector<size_type> position_;
+        size_type size_;
+    };
+}
+
+#endif // __SPARSE_SET_HPP__
@@ -0,0 +1,58 @@
+#ifndef __SPSC_QUEUE_HPP__
+#define __SPSC_QUEUE_HPP__
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+
+/// @brief Namespace for the SpscQueue class
+/// @details This namespace contains the lock-free queue used to hand data from one thread to another.
+/// @namespace SpscQueue
+namespace SamHovhannisyan::SpscQueue
+{
+    /// @brief Bounded lock-free single-producer single-consumer queue
+    /// @details One thread pushes and one other thread pops; neither ever blocks or allocates.
+    ///          The producer owns tail_ and the consumer owns head_, each on its own cache
+    ///          line, and a slot is published by the release store of the index that covers
+    ///          it. The indices grow without wrapping and are masked into the buffer, which is
+    ///          why Capacity must be a power of two.
+    /// @class SpscQueue
+    /// @tparam T The type of the elements, copied in and out
+    /// @tparam Capacity The maximum number of queued elements, a power of two
+    /// @param head_ The index of the next element to pop, written by the consumer only
+    /// @param tail_ The index of the next free slot, written by the producer only
+    template <typename T, size_t Capacity>
+    class SpscQueue
+    {
+        static_assert(Capacity != 0 && (Capacity & (Capacity - 1)) == 0, "capacity must be a power of two");
+
+    public:
+        typedef size_t size_type;
+
+    public:
+        SpscQueue();
+        SpscQueue(const SpscQueue& rhv) = delete;
+        const SpscQueue& operator=(const SpscQueue& rhv) = delete;
+
+        /// @brief Producer side: queue a copy of value
+        /// @return false, leaving the queue unchanged, when it is full
+        bool push(const T& value);
+        /// @brief Consumer side: move the oldest element into value
+        /// @return false when the queue is empty
+        bool pop(T& value);
+
+        /// @brief Exact for the consumer; from any other thread only a snapshot
+        bool empty() const;
+        size_type size() const;
+        static constexpr size_type capacity() { return Capacity; }
+
+    private:
+        alignas(64) std::atomic<size_type> head_;
+        alignas(64) std::atomic<size_type> tail_;
+        alignas(64) std::array<T, Capacity> buffer_;
+    };
+}
+
+#include "../templates/SpscQueue.cpp"
+
+#endif // __SPSC_QUEUE_HPP__
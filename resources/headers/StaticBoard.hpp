@@ -0,0 +1,84 @@
+#ifndef __STATIC_BOARD_HPP__
+#define __STATIC_BOARD_HPP__
+
+#include "../headers/Coordinate.hpp"
+#include "../headers/BoardView.hpp"
+
+#include <array>
+#include <cassert>
+#include <cstddef>
+
+namespace SamHovhannisyan::Board
+{
+    /// @brief Class representing a 2D board with compile-time dimensions
+    /// @details Same interface as Board<T>, so game code can be templated on either one, but
+    ///          the cells live in a std::array and every member is constexpr. Loops bounded by
+    ///          getRows()/getCols() have constant trip counts the compiler can unroll and vectorize.
+    /// @class StaticBoard
+    /// @tparam T The type of the elements in the board
+    /// @tparam Rows The number of rows in the board
+    /// @tparam Cols The number of columns in the board
+    /// @param board_ The row-major array of Rows * Cols cells
+    template <typename T, size_t Rows, size_t Cols>
+    class StaticBoard
+    {
+    public:
+        typedef Coordinate::Coordinate coordinate;
+        typedef typename coordinate::coordinate_type coordinate_type;
+        typedef size_t size_type;
+        typedef T value_type;
+        typedef T* iterator;
+        typedef const T* const_iterator;
+        typedef Row<T> row_type;
+        typedef Row<const T> const_row_type;
+        typedef BoardView<T> view_type;
+
+        static constexpr size_type ROWS = Rows;
+        static constexpr size_type COLS = Cols;
+        static constexpr size_type SIZE = Rows * Cols;
+
+    public:
+        /// @brief Constructors
+        /// @details Every cell is default constructed or set to value.
+        constexpr StaticBoard();
+        constexpr explicit StaticBoard(const T& value);
+
+        view_type getBoard() const;
+        static constexpr size_type getRows() { return Rows; }
+        static constexpr size_type getCols() { return Cols; }
+        static constexpr size_type size() { return SIZE; }
+
+        /// @brief Linear access
+        /// @details Cells are stored row-major, index = y * getCols() + x. offsetOf gives the
+        ///          compile-time index distance to the neighbour at (dx, dy).
+        static constexpr size_type indexOf(const coordinate& coord);
+        static constexpr coordinate coordinateOf(const size_type index);
+        static constexpr std::ptrdiff_t offsetOf(const int dx, const int dy) { return dy * static_cast<std::ptrdiff_t>(Cols) + dx; }
+        constexpr T& operator[](const size_type index);
+        constexpr const T& operator[](const size_type index) const;
+        constexpr T* data() { return board_.data(); }
+        constexpr const T* data() const { return board_.data(); }
+
+        row_type row(const size_type y);
+        const_row_type row(const size_type y) const;
+        constexpr iterator begin() { return board_.data(); }
+        constexpr iterator end() { return board_.data() + SIZE; }
+        constexpr const_iterator begin() const { return board_.data(); }
+        constexpr const_iterator end() const { return board_.data() + SIZE; }
+
+        /// @brief Access operators
+        /// @details This operators allow for the access of elements in the board using coordinates.
+        constexpr T& operator()(const coordinate& coord);
+        constexpr const T& operator()(const coordinate& coord) const;
+
+        constexpr void setValue(const coordinate& coord, const T& value);
+        constexpr void fill(const T& value);
+
+    private:
+        std::array<T, SIZE> board_;
+    };
+}
+
+#include "../templates/StaticBoard.cpp"
+
+#endif // __STATIC_BOARD_HPP__
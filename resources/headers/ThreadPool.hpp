@@ -0,0 +1,65 @@
+#ifndef __THREAD_POOL_HPP__
+#define __THREAD_POOL_HPP__
+
+#include <condition_variable>
+#include <cstddef>
+#include <exception>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+/// @brief Namespace for the ThreadPool class
+/// @details This namespace contains the fixed-size worker pool used by the batch simulations.
+/// @namespace ThreadPool
+namespace SamHovhannisyan::ThreadPool
+{
+    /// @brief Fixed set of worker threads for data-parallel loops
+    /// @details The workers are started once and sleep between calls. parallelFor() splits an
+    ///          index range into one contiguous chunk per thread, runs the first chunk on the
+    ///          calling thread and returns when every chunk is done, so a pool of size 1 runs
+    ///          everything inline. The first exception thrown by a chunk is rethrown to the
+    ///          caller once all chunks have finished.
+    /// @class ThreadPool
+    /// @param workers_ The worker threads; the caller is the extra thread of every call
+    /// @param generation_ Incremented for every call, wakes the workers
+    /// @param pending_ The worker chunks of the current call not finished yet
+    class ThreadPool
+    {
+    public:
+        typedef std::function<void(size_t, size_t)> task_type;
+
+    public:
+        /// @brief Constructor
+        /// @details Starts threads - 1 workers; 0 means one thread per hardware core.
+        ThreadPool(const size_t threads = 0);
+        ~ThreadPool();
+
+        ThreadPool(const ThreadPool&) = delete;
+        ThreadPool& operator=(const ThreadPool&) = delete;
+
+        /// @brief The number of threads taking part in a call, the caller included
+        size_t size() const { return workers_.size() + 1; }
+
+        /// @brief Run task(begin, end) over disjoint chunks covering 0 .. count - 1 and wait
+        void parallelFor(const size_t count, const task_type& task);
+
+    private:
+        void work(const size_t index);
+        void runChunk(const size_t index);
+
+    private:
+        std::vector<std::thread> workers_;
+        std::mutex mutex_;
+        std::condition_variable start_;
+        std::condition_variable done_;
+        const task_type* task_;
+        size_t count_;
+        size_t generation_;
+        size_t pending_;
+        std::exception_ptr error_;
+        bool stop_;
+    };
+}
+
+#endif // __THREAD_POOL_HPP__
@@ -0,0 +1,75 @@
+#ifndef __VIEWPORT_HPP__
+#define __VIEWPORT_HPP__
+
+#include "../headers/Coordinate.hpp"
+
+#include <cstddef>
+
+/// @brief Namespace for the Viewport class
+/// @details This namespace contains the window the terminal front-ends draw boards through.
+/// @namespace Viewport
+namespace SamHovhannisyan::Viewport
+{
+    /// @brief The part of a board that fits in a rectangle of the terminal
+    /// @details Knows nothing of ncurses: the front-end gives it the board size and the screen
+    ///          rectangle, in characters, and gets back which cells are visible, where to draw
+    ///          them and which cell a mouse position falls on. A cell takes cellWidth columns and
+    ///          cellHeight rows of the screen. The window never leaves the board; when the board
+    ///          is smaller than the rectangle, the whole board is shown from its top left cell.
+    ///          Moving the window only changes its origin, so the front-end redraws the visible
+    ///          cells, which keeps a frame O(visible cells) whatever the board size.
+    /// @class Viewport
+    /// @param origin_ The board cell in the top left corner of the window
+    class Viewport
+    {
+    public:
+        typedef Coordinate::Coordinate Coordinate;
+
+    public:
+        Viewport(const size_t cellWidth = 1, const size_t cellHeight = 1);
+
+        /// @brief The board size in cells; the window is moved back inside it if needed
+        void setBoard(const size_t rows, const size_t cols);
+        /// @brief The screen rectangle the board is drawn in, in characters
+        void setScreen(const int top, const int left, const int rows, const int cols);
+
+        const Coordinate& getOrigin() const { return origin_; }
+        /// @brief The number of board rows and columns shown
+        size_t getRows() const;
+        size_t getCols() const;
+        /// @brief Whether the window shows only part of the board
+        bool isClipped() const { return getRows() < boardRows_ || getCols() < boardCols_; }
+        bool isVisible(const Coordinate& coord) const;
+
+        /// @brief The screen row and column of a visible board cell
+        int screenY(const size_t y) const { return top_ + int((y - origin_.y) * cellHeight_); }
+        int screenX(const size_t x) const { return left_ + int((x - origin_.x) * cellWidth_); }
+        /// @brief The visible board cell under a screen character, if any
+        bool toBoard(const int y, const int x, Coordinate& coord) const;
+
+        /// @brief Move the window; each returns whether it moved
+        bool pan(const long dy, const long dx);
+        bool scrollTo(const Coordinate& origin);
+        bool center(const Coordinate& coord);
+        /// @brief Scroll the least needed to keep coord margin cells inside the edges
+        bool follow(const Coordinate& coord, const size_t margin = 0);
+
+    private:
+        /// @brief The origin closest to origin that keeps the window on the board
+        Coordinate clamp(const Coordinate& origin) const;
+
+    private:
+        size_t cellWidth_;
+        size_t cellHeight_;
+        size_t boardRows_;
+        size_t boardCols_;
+        int top_;
+        int left_;
+        /// @brief Whole cells that fit in the screen rectangle
+        size_t screenRows_;
+        size_t screenCols_;
+        Coordinate origin_;
+    };
+}
+
+#endif // __VIEWPORT_HPP__
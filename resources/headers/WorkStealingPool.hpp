@@ -0,0 +1,84 @@
+#ifndef __WORK_STEALING_POOL_HPP__
+#define __WORK_STEALING_POOL_HPP__
+
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <exception>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+/// @brief Namespace for the WorkStealingPool class
+/// @details This namespace contains the task pool used for irregular searches, where tasks
+///          spawn more tasks and finish at very different times.
+/// @namespace WorkStealingPool
+namespace SamHovhannisyan::WorkStealingPool
+{
+    /// @brief Worker threads with one task deque each
+    /// @details A task submitted from a worker goes to the back of that worker's deque and the
+    ///          worker takes its own work from the back, so the newest and most cache-warm task
+    ///          runs first. An idle worker steals from the front of the other deques, where the
+    ///          oldest tasks are. Tasks submitted from outside are dealt round-robin. wait() has
+    ///          the caller run tasks as well until every submitted task is done. cancel() drops
+    ///          the tasks not started yet; running tasks can poll isCancelled() to stop early.
+    ///          The first exception thrown by a task is rethrown by wait().
+    /// @class WorkStealingPool
+    /// @param queues_ One deque per worker
+    /// @param pending_ Tasks submitted and not finished yet, dropped ones excluded
+    /// @param queued_ Tasks sitting in a deque, for the workers to know whether to sleep
+    class WorkStealingPool
+    {
+    public:
+        typedef std::function<void()> task_type;
+
+    public:
+        /// @brief Constructor
+        /// @details Starts one worker per thread; 0 means one per hardware core.
+        WorkStealingPool(const size_t threads = 0);
+        ~WorkStealingPool();
+
+        WorkStealingPool(const WorkStealingPool&) = delete;
+        WorkStealingPool& operator=(const WorkStealingPool&) = delete;
+
+        size_t size() const { return queues_.size(); }
+
+        /// @brief Queue a task; ignored while the pool is cancelled
+        void submit(task_type task);
+        /// @brief Help run tasks until all of them are done, then clear the cancellation
+        void wait();
+        /// @brief Drop every task not started yet
+        void cancel();
+        bool isCancelled() const { return cancelled_.load(std::memory_order_relaxed); }
+
+    private:
+        struct Queue
+        {
+            std::mutex mutex;
+            std::deque<task_type> tasks;
+        };
+
+        void work(const size_t index);
+        /// @brief Pop from the back of deque index, or steal from the front of another
+        bool take(const size_t index, task_type& task);
+        void run(task_type& task);
+
+    private:
+        std::vector<std::unique_ptr<Queue>> queues_;
+        std::vector<std::thread> workers_;
+        std::mutex mutex_;
+        std::condition_variable wake_;
+        std::condition_variable done_;
+        std::atomic<size_t> pending_;
+        std::atomic<size_t> queued_;
+        std::atomic<size_t> next_;
+        std::atomic<bool> cancelled_;
+        std::exception_ptr error_;
+        bool stop_;
+    };
+}
+
+#endif // __WORK_STEALING_POOL_HPP__
@@ -0,0 +1,151 @@
+#include "headers/Board.hpp"
+#include "headers/BitBoard.hpp"
+#include "headers/Snapshot.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <vector>
+
+namespace
+{
+    typedef std::chrono::steady_clock clock_type;
+
+    template <typename Function>
+    double
+    measure(const size_t repeats, Function function)
+    {
+        const clock_type::time_point start = clock_type::now();
+        for (size_t i = 0; i < repeats; ++i) { function(); }
+        const std::chrono::duration<double, std::nano> elapsed = clock_type::now() - start;
+        return elapsed.count() / repeats;
+    }
+
+    /// Full-board scan the way the games did it before the flat storage
+    size_t
+    scanNested(const std::vector<std::vector<int>>& board)
+    {
+        size_t count = 0;
+        for (size_t y = 0; y < board.size(); ++y) {
+            for (size_t x = 0; x < board[y].size(); ++x) {
+                count += board[y][x] == 0;
+            }
+        }
+        return count;
+    }
+
+    size_t
+    scanCoordinates(const SamHovhannisyan::Board::Board<int>& board)
+    {
+        size_t count = 0;
+        for (size_t y = 0; y < board.getRows(); ++y) {
+            for (size_t x = 0; x < board.getCols(); ++x) {
+                count += board({x, y}) == 0;
+            }
+        }
+        return count;
+    }
+
+    size_t
+    scanCells(const SamHovhannisyan::Board::Board<int>& board)
+    {
+        size_t count = 0;
+        for (const int cell : board) { count += cell == 0; }
+        return count;
+    }
+
+    size_t
+    scanView(const SamHovhannisyan::Board::BoardView<int>& view)
+    {
+        size_t count = 0;
+        for (size_t y = 0; y < view.getRows(); ++y) {
+            for (const int cell : view.row(y)) { count += cell == 0; }
+        }
+        return count;
+    }
+
+    /// Minesweeper numbers the way placeBomb computed them, one mine at a time
+    void
+    countPerMine(const SamHovhannisyan::Board::Board<uint8_t>& mines, SamHovhannisyan::Board::Board<uint8_t>& counts)
+    {
+        counts.fill(0);
+        for (size_t y = 0; y < mines.getRows(); ++y) {
+            for (size_t x = 0; x < mines.getCols(); ++x) {
+                if (!mines({x, y})) { continue; }
+                for (int dy = -1; dy <= 1; ++dy) {
+                    for (int dx = -1; dx <= 1; ++dx) {
+                        const size_t nx = x + dx;
+                        const size_t ny = y + dy;
+                        if ((dx != 0 || dy != 0) && nx < mines.getCols() && ny < mines.getRows()) { ++counts({nx, ny}); }
+                    }
+                }
+            }
+        }
+    }
+}
+
+int
+main()
+{
+    std::printf("%10s %12s %12s %12s %12s %12s %12s\n",
+                "size", "nested ns", "coord ns", "cells ns", "view ns", "copy ns", "getBoard ns");
+    volatile size_t sink = 0;
+    for (size_t size = 16; size <= 4096; size *= 2) {
+        const size_t repeats = std::max<size_t>(1, (1 << 24) / (size * size));
+        std::vector<std::vector<int>> nested(size, std::vector<int>(size, 0));
+        SamHovhannisyan::Board::Board<int> board(size, size);
+
+        const double nestedTime = measure(repeats, [&]() { sink = sink + scanNested(nested); });
+        const double coordTime  = measure(repeats, [&]() { sink = sink + scanCoordinates(board); });
+        const double cellsTime  = measure(repeats, [&]() { sink = sink + scanCells(board); });
+        const double viewTime   = measure(repeats, [&]() { sink = sink + scanView(board.getBoard()); });
+        const double copyTime   = measure(repeats, [&]() { sink = sink + std::vector<std::vector<int>>(nested).size(); });
+        const double getTime    = measure(repeats, [&]() { sink = sink + board.getBoard().size(); });
+
+        std::printf("%5zux%-5zu %12.0f %12.0f %12.0f %12.0f %12.0f %12.1f\n",
+                    size, size, nestedTime, coordTime, cellsTime, viewTime, copyTime, getTime);
+    }
+
+    std::printf("\n%10s %12s %12s %12s %12s %12s %12s\n",
+                "size", "bytes/cell", "bits/cell", "count ns", "popcount ns", "per-mine ns", "kernel ns");
+    for (size_t size = 16; size <= 4096; size *= 2) {
+        const size_t repeats = std::max<size_t>(1, (1 << 22) / (size * size));
+        SamHovhannisyan::Board::Board<uint8_t> bytes(size, size);
+        SamHovhannisyan::Board::Board<uint8_t> counts(size, size);
+        SamHovhannisyan::BitBoard::BitBoard bits(size, size);
+        for (size_t i = 0; i < bytes.size(); i += 6) {
+            bytes[i] = 1;
+            bits.set(bytes.coordinateOf(i));
+        }
+
+        const double countTime  = measure(repeats, [&]() { sink = sink + std::count(bytes.begin(), bytes.end(), 1); });
+        const double bitsTime   = measure(repeats, [&]() { sink = sink + bits.count(); });
+        const double mineTime   = measure(repeats, [&]() { countPerMine(bytes, counts); });
+        const double kernelTime = measure(repeats, [&]() { bits.neighbourCounts(counts.data()); });
+        const double bitsPerCell = 64.0 * bits.getWordsPerRow() * bits.getRows() / bytes.size();
+
+        std::printf("%5zux%-5zu %12zu %12.2f %12.0f %12.0f %12.0f %12.0f\n",
+                    size, size, sizeof(uint8_t), bitsPerCell, countTime, bitsTime, mineTime, kernelTime);
+    }
+
+    std::printf("\n%10s %12s %12s %12s\n", "size", "MiB", "save ms", "map ms");
+    for (size_t size = 1024; size <= 8192; size *= 2) {
+        const std::string path = "builds/bench_snapshot.bin";
+        const uint32_t kind = SamHovhannisyan::Snapshot::kindOf("BNCH");
+        SamHovhannisyan::Board::Board<int> board(size, size);
+        board.fill(1);
+
+        const double saveTime = measure(1, [&]() {
+            SamHovhannisyan::Snapshot::save(path, kind, board, SamHovhannisyan::Snapshot::StateWriter());
+        });
+        const double mapTime = measure(1, [&]() {
+            const SamHovhannisyan::Snapshot::MappedBoard<int> snapshot(path, kind);
+            sink = sink + snapshot.getBoard()({size - 1, size - 1});
+        });
+        std::remove(path.c_str());
+
+        std::printf("%5zux%-5zu %12zu %12.1f %12.3f\n",
+                    size, size, board.size() * sizeof(int) >> 20, saveTime / 1e6, mapTime / 1e6);
+    }
+    return 0;
+}
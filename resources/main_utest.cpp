@@ -1,5 +1,26 @@
 #include "headers/Board.hpp"
+#include "headers/BitBoard.hpp"
+#include "headers/StaticBoard.hpp"
+#include "headers/ChunkedBoard.hpp"
+#include "headers/Snapshot.hpp"
+#include "headers/Scheduler.hpp"
+#include "headers/RingBuffer.hpp"
+#include "headers/SparseSet.hpp"
+#include "headers/Random.hpp"
+#include "headers/SpscQueue.hpp"
+#include "headers/Histogram.hpp"
+#include "headers/ThreadPool.hpp"
+#include "headers/WorkStealingPool.hpp"
+#include "headers/Viewport.hpp"
 #include <gtest/gtest.h>
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstring>
+#include <fstream>
+#include <functional>
+#include <stdexcept>
+#include <thread>
 
 TEST(BoardTest, DefaultConstructor)
 {
@@ -36,12 +57,70 @@ TEST(BoardTest, SetValueAndGetValue)
 TEST(BoardTest, GetBoard)
 {
     SamHovhannisyan::Board::Board<int> board(3, 4);
-    std::vector<std::vector<int>> expected = {
-        {0, 0, 0, 0},
-        {0, 0, 0, 0},
-        {0, 0, 0, 0}
-    };
-    EXPECT_EQ(board.getBoard(), expected);
+    board({3, 2}) = 7;
+    const SamHovhannisyan::Board::BoardView<int> view = board.getBoard();
+    EXPECT_EQ(view.getRows(), 3);
+    EXPECT_EQ(view.getCols(), 4);
+    EXPECT_EQ(view.data(), board.data());
+    EXPECT_EQ(view({3, 2}), 7);
+    EXPECT_EQ(view({0, 0}), 0);
+}
+
+TEST(BoardTest, RowMajorStorage)
+{
+    SamHovhannisyan::Board::Board<int> board(3, 4);
+    board({1, 2}) = 5;
+    EXPECT_EQ(board.indexOf({1, 2}), 9);
+    EXPECT_EQ(board[9], 5);
+    EXPECT_EQ(board.coordinateOf(9), SamHovhannisyan::Coordinate::Coordinate(1, 2));
+    EXPECT_EQ(board.row(2)[1], 5);
+    EXPECT_EQ(board.row(2).size(), 4);
+}
+
+TEST(BoardTest, CellIterators)
+{
+    SamHovhannisyan::Board::Board<int> board(3, 4);
+    int value = 0;
+    for (int& cell : board) { cell = value++; }
+    EXPECT_EQ(board({0, 1}), 4);
+    EXPECT_EQ(board({3, 2}), 11);
+    EXPECT_EQ(board.end() - board.begin(), 12);
+}
+
+TEST(BoardTest, ResizeKeepsCells)
+{
+    SamHovhannisyan::Board::Board<int> board(3, 4);
+    board({1, 1}) = 3;
+    board({3, 2}) = 4;
+    board.resize(4, 2);
+    EXPECT_EQ(board.getRows(), 4);
+    EXPECT_EQ(board.getCols(), 2);
+    EXPECT_EQ(board({1, 1}), 3);
+    EXPECT_EQ(board({1, 3}), 0);
+}
+
+TEST(BoardTest, DirtyTracking)
+{
+    SamHovhannisyan::Board::Board<int> board(3, 4);
+    board.setDirtyTracking(true);
+    EXPECT_TRUE(board.isAllDirty());
+    board.clearDirty();
+    EXPECT_TRUE(board.getDirty().empty());
+
+    board({1, 2}) = 5;
+    board.setValue({1, 2}, 6);
+    board.markDirty({3, 0});
+    EXPECT_EQ(board.getBoard()({0, 0}), 0);
+    ASSERT_EQ(board.getDirty().size(), 2);
+    EXPECT_EQ(board.getDirty()[0], board.indexOf({1, 2}));
+    EXPECT_EQ(board.getDirty()[1], board.indexOf({3, 0}));
+    EXPECT_FALSE(board.isAllDirty());
+
+    board.fill(1);
+    EXPECT_TRUE(board.isAllDirty());
+    board.clearDirty();
+    EXPECT_FALSE(board.isAllDirty());
+    EXPECT_TRUE(board.getDirty().empty());
 }
 
 TEST(BoardTest, SetRows)
@@ -104,9 +183,556 @@ TEST(BoardTest, OperatorDefaultConstructor)
     EXPECT_EQ(coord.y, 0);
 }
 
+TEST(BitBoardTest, SetAndCount)
+{
+    SamHovhannisyan::BitBoard::BitBoard board(3, 130);
+    board.set({0, 0});
+    board.set({129, 2});
+    board.setValue({64, 1}, true);
+    EXPECT_TRUE(board({129, 2}));
+    EXPECT_FALSE(board({128, 2}));
+    EXPECT_EQ(board.count(), 3);
+    board.flip({0, 0});
+    EXPECT_EQ(board.count(), 2);
+    EXPECT_EQ((~board).count(), 3 * 130 - 2);
+}
+
+TEST(BitBoardTest, BitwiseOperations)
+{
+    SamHovhannisyan::BitBoard::BitBoard lhv(2, 70);
+    SamHovhannisyan::BitBoard::BitBoard rhv(2, 70);
+    lhv.set({1, 0});
+    lhv.set({65, 1});
+    rhv.set({65, 1});
+    rhv.set({3, 0});
+    EXPECT_EQ((lhv & rhv).count(), 1);
+    EXPECT_EQ((lhv | rhv).count(), 3);
+    EXPECT_EQ((lhv ^ rhv).count(), 2);
+    EXPECT_EQ(lhv.andNot(rhv).count(), 1);
+    EXPECT_TRUE(lhv({1, 0}));
+}
+
+TEST(BitBoardTest, Shifted)
+{
+    SamHovhannisyan::BitBoard::BitBoard board(4, 100);
+    board.set({63, 1});
+    board.set({99, 2});
+    const SamHovhannisyan::BitBoard::BitBoard moved = board.shifted(1, 1);
+    EXPECT_TRUE(moved({64, 2}));
+    EXPECT_EQ(moved.count(), 1);
+    EXPECT_EQ(moved.shifted(-65, -2).count(), 0);
+    EXPECT_TRUE(board.shifted(-63, 0)({0, 1}));
+}
+
+TEST(BitBoardTest, NeighbourCounts)
+{
+    const size_t rows = 37;
+    const size_t cols = 150;
+    SamHovhannisyan::BitBoard::BitBoard mines(rows, cols);
+    for (size_t y = 0; y < rows; ++y) {
+        for (size_t x = 0; x < cols; ++x) {
+            if ((x * 7 + y * 13) % 5 == 0) { mines.set({x, y}); }
+        }
+    }
+
+    std::vector<uint8_t> counts(rows * cols);
+    mines.neighbourCounts(counts.data());
+    for (size_t y = 0; y < rows; ++y) {
+        for (size_t x = 0; x < cols; ++x) {
+            int expected = 0;
+            for (int dy = -1; dy <= 1; ++dy) {
+                for (int dx = -1; dx <= 1; ++dx) {
+                    const size_t nx = x + dx;
+                    const size_t ny = y + dy;
+                    if ((dx != 0 || dy != 0) && nx < cols && ny < rows) { expected += mines({nx, ny}); }
+                }
+            }
+            ASSERT_EQ(counts[y * cols + x], expected) << x << ' ' << y;
+        }
+    }
+}
+
+namespace
+{
+    template <typename BoardType>
+    size_t
+    countValue(const BoardType& board, const typename BoardType::value_type& value)
+    {
+        size_t count = 0;
+        for (size_t y = 0; y < board.getRows(); ++y) {
+            for (const auto& cell : board.row(y)) { count += cell == value; }
+        }
+        return count;
+    }
+
+    constexpr SamHovhannisyan::Board::StaticBoard<int, 3, 4>
+    makeDiagonal()
+    {
+        SamHovhannisyan::Board::StaticBoard<int, 3, 4> board;
+        for (size_t i = 0; i < board.getRows(); ++i) { board({i, i}) = 1; }
+        return board;
+    }
+}
+
+TEST(StaticBoardTest, ConstexprConstruction)
+{
+    constexpr SamHovhannisyan::Board::StaticBoard<int, 3, 4> board = makeDiagonal();
+    static_assert(board.getRows() == 3 && board.getCols() == 4, "dimensions are compile-time constants");
+    static_assert(board({2, 2}) == 1 && board({3, 2}) == 0, "cells are readable at compile time");
+    static_assert(board.offsetOf(1, -1) == -3, "neighbour offsets are compile-time constants");
+    EXPECT_EQ(board.indexOf({3, 2}), 11);
+    EXPECT_EQ(board.coordinateOf(11), SamHovhannisyan::Coordinate::Coordinate(3, 2));
+}
+
+TEST(StaticBoardTest, SharedInterface)
+{
+    SamHovhannisyan::Board::StaticBoard<int, 3, 4> fixed(7);
+    SamHovhannisyan::Board::Board<int> dynamic(3, 4);
+    dynamic.fill(7);
+    fixed.setValue({1, 1}, 0);
+    dynamic.setValue({1, 1}, 0);
+    EXPECT_EQ(countValue(fixed, 7), 11);
+    EXPECT_EQ(countValue(dynamic, 7), 11);
+    EXPECT_EQ(fixed.getBoard()({1, 1}), dynamic.getBoard()({1, 1}));
+}
+
+TEST(ChunkedBoardTest, LazyTiles)
+{
+    const SamHovhannisyan::Board::ChunkedBoard<int, 16>::size_type side = 1000000;
+    SamHovhannisyan::Board::ChunkedBoard<int, 16> board(side, side, -1);
+    const SamHovhannisyan::Board::ChunkedBoard<int, 16>& view = board;
+    EXPECT_EQ(view({side - 1, side - 1}), -1);
+    EXPECT_EQ(board.getTileCount(), 0);
+
+    board.setValue({side - 1, side - 1}, 5);
+    board({17, 3}) = 6;
+    EXPECT_EQ(view({side - 1, side - 1}), 5);
+    EXPECT_EQ(view({17, 3}), 6);
+    EXPECT_EQ(view({16, 3}), -1);
+    EXPECT_EQ(board.getTileCount(), 2);
+    EXPECT_TRUE(board.isResident({31, 15}));
+    EXPECT_FALSE(board.isResident({32, 15}));
+}
+
+TEST(ChunkedBoardTest, LeastRecentlyUsedEviction)
+{
+    typedef SamHovhannisyan::Board::ChunkedBoard<int, 4> board_type;
+    std::unordered_map<board_type::tile_key, board_type::Tile> store;
+    board_type board(64, 64, 0, 2);
+    board.setTileEvictor([&store](const board_type::tile_key key, const board_type::Tile& tile) { store[key] = tile; });
+    board.setTileLoader([&store](const board_type::tile_key key, board_type::Tile& tile) {
+        const auto found = store.find(key);
+        if (found == store.end()) { return false; }
+        tile = found->second;
+        return true;
+    });
+
+    board({0, 0}) = 1;
+    board({4, 0}) = 2;
+    board({0, 0}) = 1;
+    board({8, 0}) = 3;
+    EXPECT_EQ(board.getTileCount(), 2);
+    EXPECT_FALSE(board.isResident({4, 0}));
+    EXPECT_EQ(store.size(), 1);
+
+    const board_type& view = board;
+    EXPECT_EQ(view({4, 0}), 2);
+    EXPECT_EQ(view({0, 0}), 1);
+    EXPECT_EQ(view({8, 0}), 3);
+    EXPECT_EQ(board.getTileCount(), 2);
+
+    // A tile the loader has nothing for reads as default and stays out of the cache
+    EXPECT_EQ(view({12, 12}), 0);
+    EXPECT_FALSE(board.isResident({12, 12}));
+
+    // Without an evictor the writes to an evicted tile are gone
+    board_type unsaved(64, 64, 0, 1);
+    unsaved({0, 0}) = 1;
+    unsaved({4, 0}) = 2;
+    EXPECT_EQ(unsaved({0, 0}), 0);
+    EXPECT_EQ(unsaved({4, 0}), 0);
+}
+
+TEST(SnapshotTest, SaveAndMap)
+{
+    const std::string path = "builds/snapshot_test.bin";
+    SamHovhannisyan::Board::Board<std::pair<int, bool>> board(3, 5);
+    board({4, 2}) = {9, true};
+    SamHovhannisyan::Snapshot::StateWriter state;
+    state.put<uint64_t>(42);
+    state.put(true);
+    SamHovhannisyan::Snapshot::save(path, SamHovhannisyan::Snapshot::kindOf("TEST"), board, state);
+
+    const SamHovhannisyan::Snapshot::MappedBoard<std::pair<int, bool>> snapshot(path, SamHovhannisyan::Snapshot::kindOf("TEST"));
+    const auto view = snapshot.getBoard();
+    EXPECT_EQ(view.getRows(), 3);
+    EXPECT_EQ(view.getCols(), 5);
+    EXPECT_EQ(reinterpret_cast<uintptr_t>(view.data()) % SamHovhannisyan::Snapshot::CELLS_ALIGNMENT, 0);
+    EXPECT_EQ(view({4, 2}).first, 9);
+    EXPECT_TRUE(view({4, 2}).second);
+    SamHovhannisyan::Snapshot::StateReader reader = snapshot.getState();
+    EXPECT_EQ(reader.get<uint64_t>(), 42);
+    EXPECT_TRUE(reader.get<bool>());
+    EXPECT_THROW(reader.get<uint64_t>(), std::runtime_error);
+
+    SamHovhannisyan::Board::Board<std::pair<int, bool>> restored(3, 5);
+    SamHovhannisyan::Snapshot::restore(view, restored);
+    EXPECT_EQ(restored({4, 2}).first, 9);
+    typedef SamHovhannisyan::Snapshot::MappedBoard<std::pair<int, bool>> mapped_type;
+    EXPECT_THROW(mapped_type(path, SamHovhannisyan::Snapshot::kindOf("GAME")), std::runtime_error);
+    EXPECT_THROW(SamHovhannisyan::Snapshot::MappedBoard<int>(path, SamHovhannisyan::Snapshot::kindOf("TEST")), std::runtime_error);
+}
+
+TEST(SnapshotTest, RejectsCorruptHeaders)
+{
+    typedef SamHovhannisyan::Snapshot::Header Header;
+    typedef SamHovhannisyan::Snapshot::MappedBoard<int> mapped_type;
+    const std::string path = "builds/snapshot_corrupt_test.bin";
+    SamHovhannisyan::Board::Board<int> board(2, 2);
+    SamHovhannisyan::Snapshot::StateWriter state;
+    state.put<uint64_t>(1);
+    SamHovhannisyan::Snapshot::save(path, SamHovhannisyan::Snapshot::kindOf("TEST"), board, state);
+
+    std::string bytes;
+    {
+        std::ifstream in(path, std::ios::binary);
+        bytes.assign(std::istreambuf_iterator<char>(in), std::istreambuf_iterator<char>());
+    }
+    Header original;
+    std::memcpy(&original, bytes.data(), sizeof(Header));
+
+    // Each header has sizes or offsets that wrap around 2^64 or point into the header
+    const std::function<void(Header&)> corruptions[] = {
+        [](Header& header) { header.stateOffset = ~uint64_t(7); header.stateSize = 16; },
+        [](Header& header) { header.rows = uint64_t(1) << 63; header.cols = 2; },
+        [](Header& header) { header.rows = uint64_t(1) << 62; header.cols = 1; },
+        [](Header& header) { header.cellsOffset = ~uint64_t(SamHovhannisyan::Snapshot::CELLS_ALIGNMENT - 1); },
+        [](Header& header) { header.stateOffset = 0; },
+    };
+    for (const std::function<void(Header&)>& corrupt : corruptions) {
+        Header header = original;
+        corrupt(header);
+        std::string file = bytes;
+        std::memcpy(&file[0], &header, sizeof(Header));
+        std::ofstream(path, std::ios::binary | std::ios::trunc) << file;
+        EXPECT_THROW(mapped_type(path, SamHovhannisyan::Snapshot::kindOf("TEST")), std::runtime_error);
+    }
+}
+
+TEST(SnapshotTest, BackgroundWriter)
+{
+    const std::string path = "builds/snapshot_writer_test.bin";
+    SamHovhannisyan::Board::Board<int> board(64, 64);
+    board({63, 63}) = 7;
+    SamHovhannisyan::Snapshot::Writer writer;
+    EXPECT_TRUE(writer.write(path, SamHovhannisyan::Snapshot::kindOf("TEST"), board, SamHovhannisyan::Snapshot::StateWriter()));
+    board({63, 63}) = 8;
+    EXPECT_TRUE(writer.wait());
+
+    const SamHovhannisyan::Snapshot::MappedBoard<int> snapshot(path, SamHovhannisyan::Snapshot::kindOf("TEST"));
+    EXPECT_EQ(snapshot.getBoard()({63, 63}), 7);
+}
+
+TEST(RingBufferTest, WrapsAroundBothEnds)
+{
+    SamHovhannisyan::RingBuffer::RingBuffer<int> ring(3);
+    ring.push_front(1);
+    ring.push_front(0);
+    ring.push_back(2);
+    EXPECT_TRUE(ring.full());
+    EXPECT_EQ(ring.front(), 0);
+    EXPECT_EQ(ring.back(), 2);
+
+    // Slide the window around the storage like a moving snake
+    for (int i = 0; i < 7; ++i) {
+        ring.pop_back();
+        ring.push_front(-i - 1);
+    }
+    ASSERT_EQ(ring.size(), 3);
+    EXPECT_EQ(ring[0], -7);
+    EXPECT_EQ(ring[1], -6);
+    EXPECT_EQ(ring[2], -5);
+    ring.pop_front();
+    EXPECT_EQ(ring.front(), -6);
+    ring.clear();
+    EXPECT_TRUE(ring.empty());
+}
+
+TEST(SparseSetTest, SwapRemove)
+{
+    SamHovhannisyan::SparseSet::SparseSet set(10);
+    set.fill();
+    EXPECT_EQ(set.size(), 10);
+    set.erase(3);
+    set.erase(3);
+    set.erase(0);
+    EXPECT_EQ(set.size(), 8);
+    EXPECT_FALSE(set.contains(3));
+    EXPECT_TRUE(set.contains(9));
+
+    // Every remaining member is reachable by position exactly once
+    size_t sum = 0;
+    for (size_t k = 0; k < set.size(); ++k) { sum += set[k]; }
+    EXPECT_EQ(sum, 45 - 3);
+
+    set.insert(3);
+    set.insert(3);
+    EXPECT_EQ(set.size(), 9);
+    EXPECT_TRUE(set.contains(3));
+    set.clear();
+    EXPECT_FALSE(set.contains(3));
+}
+
+TEST(SchedulerTest, AbsoluteDeadlines)
+{
+    typedef std::chrono::steady_clock clock_type;
+    const int64_t period = 10000000;
+    const clock_type::time_point start = clock_type::now();
+    SamHovhannisyan::Scheduler::Scheduler scheduler(period);
+
+    // Work inside a tick must not stretch the period: a relative sleep would take 15 periods,
+    // absolute deadlines take 10.5. A preempted loop may get several ticks from one wait().
+    size_t ticks = 0;
+    while (ticks < 10) {
+        ticks += scheduler.wait();
+        std::this_thread::sleep_for(std::chrono::nanoseconds(period / 2));
+    }
+    const std::chrono::nanoseconds elapsed = clock_type::now() - start;
+    EXPECT_GE(elapsed.count(), 10 * period);
+    EXPECT_LT(elapsed.count(), 14 * period);
+    EXPECT_EQ(scheduler.getStatistics().ticks, ticks);
+
+    // Falling behind returns every tick that is due at once
+    std::this_thread::sleep_for(std::chrono::nanoseconds(4 * period));
+    EXPECT_FALSE(scheduler.shouldRender());
+    const size_t due = scheduler.wait();
+    EXPECT_GE(due, 3);
+    EXPECT_LE(due, SamHovhannisyan::Scheduler::Scheduler::MAX_CATCH_UP);
+    EXPECT_GE(scheduler.getStatistics().overruns, 1);
+    EXPECT_EQ(scheduler.getStatistics().ticks, ticks + due);
+}
+
+TEST(RandomTest, SplitMixIsReproducible)
+{
+    // Reference outputs of SplitMix64 for seed 0
+    SamHovhannisyan::Random::SplitMix64 random(0);
+    EXPECT_EQ(random(), 0xE220A8397B1DCDAFull);
+    EXPECT_EQ(random(), 0x6E789E6AA1B965F4ull);
+
+    // A copied state continues the same stream
+    SamHovhannisyan::Random::SplitMix64 copy(0);
+    copy.setState(random.getState());
+    for (size_t i = 0; i < 100; ++i) {
+        const uint64_t bound = i + 1;
+        const uint64_t value = random.below(bound);
+        EXPECT_EQ(copy.below(bound), value);
+        EXPECT_LT(value, bound);
+    }
+}
+
+TEST(ThreadPoolTest, CoversRangeOnce)
+{
+    SamHovhannisyan::ThreadPool::ThreadPool pool(4);
+    EXPECT_EQ(pool.size(), 4);
+
+    for (const size_t count : { 0, 1, 3, 1000 }) {
+        std::vector<int> hits(count, 0);
+        std::atomic<size_t> chunks(0);
+        pool.parallelFor(count, [&](const size_t begin, const size_t end) {
+            ++chunks;
+            for (size_t i = begin; i < end; ++i) { ++hits[i]; }
+        });
+        EXPECT_EQ(std::count(hits.begin(), hits.end(), 1), count);
+        EXPECT_LE(chunks.load(), pool.size());
+    }
+}
+
+TEST(ThreadPoolTest, RethrowsAfterAllChunks)
+{
+    SamHovhannisyan::ThreadPool::ThreadPool pool(3);
+    std::atomic<size_t> finished(0);
+    EXPECT_THROW(pool.parallelFor(30, [&](const size_t begin, const size_t) {
+        if (begin == 0) { throw std::runtime_error("chunk failed"); }
+        ++finished;
+    }), std::runtime_error);
+    EXPECT_EQ(finished.load(), 2);
+
+    // The pool stays usable after a failed call
+    std::atomic<size_t> total(0);
+    pool.parallelFor(30, [&](const size_t begin, const size_t end) { total += end - begin; });
+    EXPECT_EQ(total.load(), 30);
+}
+
+TEST(SpscQueueTest, FifoAcrossWrap)
+{
+    SamHovhannisyan::SpscQueue::SpscQueue<int, 4> queue;
+    int value = 0;
+    EXPECT_FALSE(queue.pop(value));
+
+    // Fill and drain past the end of the buffer a few times
+    for (int round = 0; round < 3; ++round) {
+        for (int i = 0; i < 4; ++i) { EXPECT_TRUE(queue.push(round * 10 + i)); }
+        EXPECT_FALSE(queue.push(99));
+        EXPECT_EQ(queue.size(), 4);
+        for (int i = 0; i < 4; ++i) {
+            EXPECT_TRUE(queue.pop(value));
+            EXPECT_EQ(value, round * 10 + i);
+        }
+        EXPECT_TRUE(queue.empty());
+    }
+}
+
+TEST(SpscQueueTest, ProducerConsumerThreads)
+{
+    const size_t COUNT = 200000;
+    SamHovhannisyan::SpscQueue::SpscQueue<size_t, 64> queue;
+    std::thread producer([&queue, COUNT]() {
+        for (size_t i = 0; i < COUNT; ++i) {
+            while (!queue.push(i)) { std::this_thread::yield(); }
+        }
+    });
+
+    // Every value arrives once and in order
+    size_t expected = 0;
+    while (expected < COUNT) {
+        size_t value;
+        if (!queue.pop(value)) { std::this_thread::yield(); continue; }
+        ASSERT_EQ(value, expected);
+        ++expected;
+    }
+    producer.join();
+    EXPECT_TRUE(queue.empty());
+}
+
+TEST(HistogramTest, BucketsAndPercentiles)
+{
+    typedef SamHovhannisyan::Histogram::Histogram Histogram;
+    // Buckets are contiguous and every value falls inside its own bucket
+    for (size_t bucket = 0; bucket + 1 < 200; ++bucket) {
+        EXPECT_EQ(Histogram::bucketOf(Histogram::lowerBound(bucket)), bucket);
+        EXPECT_EQ(Histogram::bucketOf(Histogram::lowerBound(bucket + 1) - 1), bucket);
+    }
+    EXPECT_EQ(Histogram::bucketOf(UINT64_MAX), Histogram::BUCKETS - 1);
+
+    Histogram histogram;
+    EXPECT_EQ(histogram.percentile(50), 0);
+    for (uint64_t value = 1; value <= 1000; ++value) { histogram.record(value * 1000); }
+    EXPECT_EQ(histogram.count(), 1000);
+    EXPECT_EQ(histogram.min(), 1000);
+    EXPECT_EQ(histogram.max(), 1000000);
+    EXPECT_DOUBLE_EQ(histogram.mean(), 500500.0);
+
+    // Within one bucket (12.5%) above the exact percentile
+    EXPECT_GE(histogram.percentile(50), 500000);
+    EXPECT_LE(histogram.percentile(50), 562500);
+    EXPECT_GE(histogram.percentile(99), 990000);
+    EXPECT_EQ(histogram.percentile(100), 1000000);
+}
+
 int
 main(int argc, char **argv)
 {
     ::testing::InitGoogleTest(&argc, argv);
     return RUN_ALL_TESTS();
 }
+
+TEST(WorkStealingPoolTest, RunsNestedTasks)
+{
+    SamHovhannisyan::WorkStealingPool::WorkStealingPool pool(4);
+    EXPECT_EQ(pool.size(), 4);
+
+    // A binary tree of tasks, each node submitting its children from a worker
+    std::atomic<size_t> nodes(0);
+    std::function<void(size_t)> visit = [&](const size_t depth) {
+        ++nodes;
+        if (depth == 0) { return; }
+        pool.submit([&visit, depth]() { visit(depth - 1); });
+        pool.submit([&visit, depth]() { visit(depth - 1); });
+    };
+    pool.submit([&visit]() { visit(10); });
+    pool.wait();
+    EXPECT_EQ(nodes.load(), 2047);
+
+    pool.submit([]() { throw std::runtime_error("task failed"); });
+    EXPECT_THROW(pool.wait(), std::runtime_error);
+}
+
+TEST(WorkStealingPoolTest, CancelDropsQueuedTasks)
+{
+    SamHovhannisyan::WorkStealingPool::WorkStealingPool pool(2);
+    std::atomic<size_t> ran(0);
+    std::atomic<bool> release(false);
+    for (size_t i = 0; i < 1000; ++i) {
+        pool.submit([&]() {
+            while (!release) { std::this_thread::yield(); }
+            ++ran;
+        });
+    }
+    pool.cancel();
+    EXPECT_TRUE(pool.isCancelled());
+    pool.submit([&]() { ran += 1000; });
+    release = true;
+    pool.wait();
+    EXPECT_LE(ran.load(), pool.size());
+    EXPECT_FALSE(pool.isCancelled());
+
+    // The pool takes work again once the cancelled batch is waited for
+    pool.submit([&]() { ran += 1000; });
+    pool.wait();
+    EXPECT_GE(ran.load(), 1000);
+}
+
+TEST(ViewportTest, ClipsAndMapsTheScreen)
+{
+    typedef SamHovhannisyan::Viewport::Viewport::Coordinate Coordinate;
+    SamHovhannisyan::Viewport::Viewport viewport(3, 1);
+    viewport.setBoard(100, 200);
+    viewport.setScreen(2, 4, 10, 31);
+    EXPECT_EQ(viewport.getRows(), 10u);
+    EXPECT_EQ(viewport.getCols(), 10u);
+    EXPECT_TRUE(viewport.isClipped());
+
+    Coordinate cell;
+    EXPECT_TRUE(viewport.toBoard(2, 4, cell));
+    EXPECT_EQ(cell, Coordinate(0, 0));
+    EXPECT_TRUE(viewport.toBoard(11, 33, cell));
+    EXPECT_EQ(cell, Coordinate(9, 9));
+    EXPECT_FALSE(viewport.toBoard(12, 4, cell));
+    EXPECT_FALSE(viewport.toBoard(2, 34, cell));
+
+    // A board smaller than the screen is shown whole and never scrolls
+    viewport.setBoard(5, 5);
+    EXPECT_FALSE(viewport.isClipped());
+    EXPECT_FALSE(viewport.pan(3, 3));
+    EXPECT_EQ(viewport.getOrigin(), Coordinate(0, 0));
+}
+
+TEST(ViewportTest, PansAndFollowsInsideTheBoard)
+{
+    typedef SamHovhannisyan::Viewport::Viewport::Coordinate Coordinate;
+    SamHovhannisyan::Viewport::Viewport viewport;
+    viewport.setBoard(100, 200);
+    viewport.setScreen(0, 0, 10, 20);
+
+    EXPECT_FALSE(viewport.pan(-5, -5));
+    EXPECT_TRUE(viewport.pan(1000, 1000));
+    EXPECT_EQ(viewport.getOrigin(), Coordinate(180, 90));
+    EXPECT_TRUE(viewport.center(Coordinate(50, 50)));
+    EXPECT_EQ(viewport.getOrigin(), Coordinate(40, 45));
+
+    // Following scrolls by the least amount that keeps the margin
+    EXPECT_FALSE(viewport.follow(Coordinate(50, 50), 2));
+    EXPECT_TRUE(viewport.follow(Coordinate(58, 53), 2));
+    EXPECT_EQ(viewport.getOrigin(), Coordinate(41, 46));
+    EXPECT_TRUE(viewport.follow(Coordinate(0, 0), 2));
+    EXPECT_EQ(viewport.getOrigin(), Coordinate(0, 0));
+    EXPECT_TRUE(viewport.isVisible(Coordinate(19, 9)));
+    EXPECT_FALSE(viewport.isVisible(Coordinate(20, 9)));
+
+    // A smaller screen pulls the window back inside the board
+    viewport.scrollTo(Coordinate(180, 90));
+    viewport.setScreen(0, 0, 5, 5);
+    EXPECT_EQ(viewport.getOrigin(), Coordinate(180, 90));
+    viewport.setBoard(50, 50);
+    EXPECT_EQ(viewport.getOrigin(), Coordinate(45, 45));
+}
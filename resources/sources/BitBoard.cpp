@@ -0,0 +1,418 @@
+#include "../headers/BitBoard.hpp"
+
+#include <algorithm>
+#include <cstring>
+
+// The Makefiles build for the baseline target, so AVX2 is compiled per function and picked at run time
+#if defined(__GNUC__) && defined(__x86_64__)
+#define BITBOARD_AVX2_DISPATCH
+#endif
+
+#if defined(BITBOARD_AVX2_DISPATCH) || defined(__SSE2__)
+#include <immintrin.h>
+#endif
+
+namespace SamHovhannisyan::BitBoard
+{
+namespace
+{
+    typedef BitBoard::word_type word_type;
+
+    enum Operation
+    {
+        AND,
+        OR,
+        XOR,
+        AND_NOT
+    };
+
+    template <Operation Op>
+    inline word_type
+    apply(const word_type lhv, const word_type rhv)
+    {
+        switch (Op)
+        {
+        case AND:     return lhv & rhv;
+        case OR:      return lhv | rhv;
+        case XOR:     return lhv ^ rhv;
+        case AND_NOT: return lhv & ~rhv;
+        }
+        return lhv;
+    }
+
+#if defined(BITBOARD_AVX2_DISPATCH)
+    bool
+    supportsAvx2()
+    {
+        // Static initialisers may run before the CPU model is filled in
+        __builtin_cpu_init();
+        return __builtin_cpu_supports("avx2");
+    }
+
+    const bool HAS_AVX2 = supportsAvx2();
+
+    template <Operation Op>
+    __attribute__((target("avx2"))) inline __m256i
+    apply(const __m256i lhv, const __m256i rhv)
+    {
+        switch (Op)
+        {
+        case AND:     return _mm256_and_si256(lhv, rhv);
+        case OR:      return _mm256_or_si256(lhv, rhv);
+        case XOR:     return _mm256_xor_si256(lhv, rhv);
+        case AND_NOT: return _mm256_andnot_si256(rhv, lhv);
+        }
+        return lhv;
+    }
+
+    /// @return The number of words combined, a multiple of four
+    template <Operation Op>
+    __attribute__((target("avx2"))) size_t
+    combineAvx2(word_type* destination, const word_type* source, const size_t size)
+    {
+        size_t i = 0;
+        for (; i + 4 <= size; i += 4) {
+            const __m256i lhv = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(destination + i));
+            const __m256i rhv = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(source + i));
+            _mm256_storeu_si256(reinterpret_cast<__m256i*>(destination + i), apply<Op>(lhv, rhv));
+        }
+        return i;
+    }
+
+    /// @brief Nibble lookup table, summed per 64-bit lane with SAD
+    /// @return The bits set in the first words, a multiple of four, and their count in done
+    __attribute__((target("avx2"))) size_t
+    popcountAvx2(const word_type* words, const size_t size, size_t& done)
+    {
+        const __m256i lookup = _mm256_setr_epi8(0, 1, 1, 2, 1, 2, 2, 3, 1, 2, 2, 3, 2, 3, 3, 4,
+                                                0, 1, 1, 2, 1, 2, 2, 3, 1, 2, 2, 3, 2, 3, 3, 4);
+        const __m256i low = _mm256_set1_epi8(0x0f);
+        __m256i accumulator = _mm256_setzero_si256();
+        size_t i = 0;
+        for (; i + 4 <= size; i += 4) {
+            const __m256i value = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(words + i));
+            const __m256i lo = _mm256_and_si256(value, low);
+            const __m256i hi = _mm256_and_si256(_mm256_srli_epi16(value, 4), low);
+            const __m256i counts = _mm256_add_epi8(_mm256_shuffle_epi8(lookup, lo), _mm256_shuffle_epi8(lookup, hi));
+            accumulator = _mm256_add_epi64(accumulator, _mm256_sad_epu8(counts, _mm256_setzero_si256()));
+        }
+        done = i;
+        return _mm256_extract_epi64(accumulator, 0) + _mm256_extract_epi64(accumulator, 1) +
+               _mm256_extract_epi64(accumulator, 2) + _mm256_extract_epi64(accumulator, 3);
+    }
+#endif
+
+#if defined(__SSE2__)
+    template <Operation Op>
+    inline __m128i
+    apply(const __m128i lhv, const __m128i rhv)
+    {
+        switch (Op)
+        {
+        case AND:     return _mm_and_si128(lhv, rhv);
+        case OR:      return _mm_or_si128(lhv, rhv);
+        case XOR:     return _mm_xor_si128(lhv, rhv);
+        case AND_NOT: return _mm_andnot_si128(rhv, lhv);
+        }
+        return lhv;
+    }
+#endif
+
+    template <Operation Op>
+    void
+    combine(word_type* destination, const word_type* source, const size_t size)
+    {
+        size_t i = 0;
+#if defined(BITBOARD_AVX2_DISPATCH)
+        if (HAS_AVX2) { i = combineAvx2<Op>(destination, source, size); }
+#endif
+#if defined(__SSE2__)
+        for (; i + 2 <= size; i += 2) {
+            const __m128i lhv = _mm_loadu_si128(reinterpret_cast<const __m128i*>(destination + i));
+            const __m128i rhv = _mm_loadu_si128(reinterpret_cast<const __m128i*>(source + i));
+            _mm_storeu_si128(reinterpret_cast<__m128i*>(destination + i), apply<Op>(lhv, rhv));
+        }
+#endif
+        for (; i < size; ++i) { destination[i] = apply<Op>(destination[i], source[i]); }
+    }
+
+    size_t
+    popcount(const word_type* words, const size_t size)
+    {
+        size_t total = 0;
+        size_t i = 0;
+#if defined(BITBOARD_AVX2_DISPATCH)
+        if (HAS_AVX2) { total += popcountAvx2(words, size, i); }
+#endif
+#if defined(__SSE2__)
+        // SWAR bit counting on two words at a time, summed per 64-bit lane with SAD
+        const __m128i m1 = _mm_set1_epi8(0x55);
+        const __m128i m2 = _mm_set1_epi8(0x33);
+        const __m128i m4 = _mm_set1_epi8(0x0f);
+        __m128i accumulator = _mm_setzero_si128();
+        for (; i + 2 <= size; i += 2) {
+            __m128i value = _mm_loadu_si128(reinterpret_cast<const __m128i*>(words + i));
+            value = _mm_sub_epi8(value, _mm_and_si128(_mm_srli_epi64(value, 1), m1));
+            value = _mm_add_epi8(_mm_and_si128(value, m2), _mm_and_si128(_mm_srli_epi64(value, 2), m2));
+            value = _mm_and_si128(_mm_add_epi8(value, _mm_srli_epi64(value, 4)), m4);
+            accumulator = _mm_add_epi64(accumulator, _mm_sad_epu8(value, _mm_setzero_si128()));
+        }
+        total += _mm_cvtsi128_si64(accumulator) + _mm_cvtsi128_si64(_mm_unpackhi_epi64(accumulator, accumulator));
+#endif
+        for (; i < size; ++i) { total += __builtin_popcountll(words[i]); }
+        return total;
+    }
+
+    // neighbourCounts() stores eight spread cells with one memcpy, so byte k in memory must be bit 8k
+    static_assert(__BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__, "BitBoard::neighbourCounts() assumes a little-endian target");
+
+    /// Spreads the eight bits of a byte into the low bit of eight bytes
+    struct ByteSpread
+    {
+        uint64_t table[256];
+
+        ByteSpread()
+        {
+            for (unsigned value = 0; value < 256; ++value) {
+                table[value] = 0;
+                for (unsigned bit = 0; bit < 8; ++bit) {
+                    table[value] |= uint64_t((value >> bit) & 1) << (bit * 8);
+                }
+            }
+        }
+    };
+
+    const ByteSpread BYTE_SPREAD;
+
+    inline void
+    fullAdd(const word_type a, const word_type b, const word_type c, word_type& sum, word_type& carry)
+    {
+        const word_type partial = a ^ b;
+        sum = partial ^ c;
+        carry = (a & b) | (partial & c);
+    }
+}
+
+    BitBoard::BitBoard(const size_type rows, const size_type cols)
+        : rows_(rows)
+        , cols_(cols)
+        , wordsPerRow_((cols + WORD_BITS - 1) / WORD_BITS)
+        , words_(rows * wordsPerRow_, 0)
+    {}
+
+    bool
+    BitBoard::operator()(const coordinate& coord) const
+    {
+        assert(coord.y < rows_);
+        assert(coord.x < cols_);
+        return (words_[coord.y * wordsPerRow_ + coord.x / WORD_BITS] >> (coord.x % WORD_BITS)) & 1;
+    }
+
+    void
+    BitBoard::setValue(const coordinate& coord, const bool value)
+    {
+        value ? set(coord) : reset(coord);
+    }
+
+    void
+    BitBoard::set(const coordinate& coord)
+    {
+        assert(coord.y < rows_);
+        assert(coord.x < cols_);
+        words_[coord.y * wordsPerRow_ + coord.x / WORD_BITS] |= word_type(1) << (coord.x % WORD_BITS);
+    }
+
+    void
+    BitBoard::reset(const coordinate& coord)
+    {
+        assert(coord.y < rows_);
+        assert(coord.x < cols_);
+        words_[coord.y * wordsPerRow_ + coord.x / WORD_BITS] &= ~(word_type(1) << (coord.x % WORD_BITS));
+    }
+
+    void
+    BitBoard::flip(const coordinate& coord)
+    {
+        assert(coord.y < rows_);
+        assert(coord.x < cols_);
+        words_[coord.y * wordsPerRow_ + coord.x / WORD_BITS] ^= word_type(1) << (coord.x % WORD_BITS);
+    }
+
+    typename BitBoard::size_type
+    BitBoard::count() const
+    {
+        return popcount(words_.data(), words_.size());
+    }
+
+    bool
+    BitBoard::any() const
+    {
+        for (const word_type word : words_) {
+            if (word != 0) { return true; }
+        }
+        return false;
+    }
+
+    void
+    BitBoard::clear()
+    {
+        std::fill(words_.begin(), words_.end(), 0);
+    }
+
+    BitBoard&
+    BitBoard::operator&=(const BitBoard& rhv)
+    {
+        assert(rows_ == rhv.rows_ && cols_ == rhv.cols_);
+        combine<AND>(words_.data(), rhv.words_.data(), words_.size());
+        return *this;
+    }
+
+    BitBoard&
+    BitBoard::operator|=(const BitBoard& rhv)
+    {
+        assert(rows_ == rhv.rows_ && cols_ == rhv.cols_);
+        combine<OR>(words_.data(), rhv.words_.data(), words_.size());
+        return *this;
+    }
+
+    BitBoard&
+    BitBoard::operator^=(const BitBoard& rhv)
+    {
+        assert(rows_ == rhv.rows_ && cols_ == rhv.cols_);
+        combine<XOR>(words_.data(), rhv.words_.data(), words_.size());
+        return *this;
+    }
+
+    BitBoard&
+    BitBoard::andNot(const BitBoard& rhv)
+    {
+        assert(rows_ == rhv.rows_ && cols_ == rhv.cols_);
+        combine<AND_NOT>(words_.data(), rhv.words_.data(), words_.size());
+        return *this;
+    }
+
+    BitBoard
+    BitBoard::operator~() const
+    {
+        BitBoard result(*this);
+        for (word_type& word : result.words_) { word = ~word; }
+        result.maskPadding();
+        return result;
+    }
+
+    bool
+    BitBoard::operator==(const BitBoard& rhv) const
+    {
+        return rows_ == rhv.rows_ && cols_ == rhv.cols_ && words_ == rhv.words_;
+    }
+
+    BitBoard
+    BitBoard::shifted(const int dx, const int dy) const
+    {
+        BitBoard result(rows_, cols_);
+        const size_type distance = static_cast<size_type>(dx < 0 ? -dx : dx);
+        const size_type wordShift = distance / WORD_BITS;
+        const size_type bitShift = distance % WORD_BITS;
+
+        for (size_type y = 0; y < rows_; ++y) {
+            const long source = static_cast<long>(y) - dy;
+            if (source < 0 || source >= static_cast<long>(rows_)) { continue; }
+
+            const word_type* from = row(static_cast<size_type>(source));
+            word_type* to = result.row(y);
+            for (size_type i = 0; i < wordsPerRow_; ++i) {
+                if (dx >= 0) {
+                    // Cells move toward higher columns: bits move up
+                    if (i < wordShift) { continue; }
+                    const size_type j = i - wordShift;
+                    to[i] = from[j] << bitShift;
+                    if (bitShift != 0 && j > 0) { to[i] |= from[j - 1] >> (WORD_BITS - bitShift); }
+                } else {
+                    const size_type j = i + wordShift;
+                    if (j >= wordsPerRow_) { continue; }
+                    to[i] = from[j] >> bitShift;
+                    if (bitShift != 0 && j + 1 < wordsPerRow_) { to[i] |= from[j + 1] << (WORD_BITS - bitShift); }
+                }
+            }
+        }
+        result.maskPadding();
+        return result;
+    }
+
+    void
+    BitBoard::neighbourCounts(uint8_t* counts) const
+    {
+        const std::vector<word_type> empty(wordsPerRow_, 0);
+
+        for (size_type y = 0; y < rows_; ++y) {
+            const word_type* up   = y > 0         ? row(y - 1) : empty.data();
+            const word_type* mid  = row(y);
+            const word_type* down = y + 1 < rows_ ? row(y + 1) : empty.data();
+
+            for (size_type i = 0; i < wordsPerRow_; ++i) {
+                const bool hasLeft  = i > 0;
+                const bool hasRight = i + 1 < wordsPerRow_;
+                // Bit x of a "west" word holds the cell at x - 1, of an "east" word the cell at x + 1
+                const word_type upWest   = (up[i]   << 1) | (hasLeft ? up[i - 1]   >> 63 : 0);
+                const word_type upEast   = (up[i]   >> 1) | (hasRight ? up[i + 1]   << 63 : 0);
+                const word_type midWest  = (mid[i]  << 1) | (hasLeft ? mid[i - 1]  >> 63 : 0);
+                const word_type midEast  = (mid[i]  >> 1) | (hasRight ? mid[i + 1]  << 63 : 0);
+                const word_type downWest = (down[i] << 1) | (hasLeft ? down[i - 1] >> 63 : 0);
+                const word_type downEast = (down[i] >> 1) | (hasRight ? down[i + 1] << 63 : 0);
+
+                // Bit-sliced sum of eight one-bit planes into four bits
+                word_type s1, c1, s2, c2, bit0, c4, s5, c5;
+                fullAdd(upWest, up[i], upEast, s1, c1);
+                fullAdd(midWest, midEast, downWest, s2, c2);
+                const word_type s3 = down[i] ^ downEast;
+                const word_type c3 = down[i] & downEast;
+                fullAdd(s1, s2, s3, bit0, c4);
+                fullAdd(c1, c2, c3, s5, c5);
+                const word_type bit1 = s5 ^ c4;
+                const word_type c6   = s5 & c4;
+                const word_type bit2 = c5 ^ c6;
+                const word_type bit3 = c5 & c6;
+
+                // Transpose the four bit planes back into one byte per cell, eight cells at a time
+                const size_type first = i * WORD_BITS;
+                const size_type last  = std::min(cols_, first + WORD_BITS);
+                uint8_t* out = counts + y * cols_;
+                for (size_type x = first; x < last; x += 8) {
+                    const size_type bit = x - first;
+                    const uint64_t cells = BYTE_SPREAD.table[(bit0 >> bit) & 0xff]        |
+                                           (BYTE_SPREAD.table[(bit1 >> bit) & 0xff] << 1) |
+                                           (BYTE_SPREAD.table[(bit2 >> bit) & 0xff] << 2) |
+                                           (BYTE_SPREAD.table[(bit3 >> bit) & 0xff] << 3);
+                    std::memcpy(out + x, &cells, std::min<size_type>(8, last - x));
+                }
+            }
+        }
+    }
+
+    void
+    BitBoard::maskPadding()
+    {
+        const size_type used = cols_ % WORD_BITS;
+        if (used == 0) { return; }
+        const word_type mask = (word_type(1) << used) - 1;
+        for (size_type y = 0; y < rows_; ++y) { row(y)[wordsPerRow_ - 1] &= mask; }
+    }
+
+    BitBoard
+    operator&(BitBoard lhv, const BitBoard& rhv)
+    {
+        return lhv &= rhv;
+    }
+
+    BitBoard
+    operator|(BitBoard lhv, const BitBoard& rhv)
+    {
+        return lhv |= rhv;
+    }
+
+    BitBoard
+    operator^(BitBoard lhv, const BitBoard& rhv)
+    {
+        return lhv ^= rhv;
+    }
+}
@@ -0,0 +1,65 @@
+#include "../headers/Histogram.hpp"
+
+#include <algorithm>
+#include <cmath>
+
+namespace SamHovhannisyan::Histogram
+{
+    Histogram::Histogram()
+    {
+        clear();
+    }
+
+    void
+    Histogram::record(const uint64_t value)
+    {
+        ++buckets_[bucketOf(value)];
+        ++count_;
+        total_ += value;
+        min_ = std::min(min_, value);
+        max_ = std::max(max_, value);
+    }
+
+    void
+    Histogram::clear()
+    {
+        buckets_.fill(0);
+        count_ = 0;
+        total_ = 0;
+        min_ = UINT64_MAX;
+        max_ = 0;
+    }
+
+    uint64_t
+    Histogram::percentile(const double percent) const
+    {
+        if (count_ == 0) { return 0; }
+        const size_t rank = std::max<size_t>(1, size_t(std::ceil(percent / 100.0 * count_)));
+
+        size_t seen = 0;
+        for (size_t bucket = 0; bucket < BUCKETS; ++bucket) {
+            seen += buckets_[bucket];
+            if (seen >= rank) {
+                const uint64_t upper = bucket + 1 < BUCKETS ? lowerBound(bucket + 1) - 1 : UINT64_MAX;
+                return std::min(upper, max_);
+            }
+        }
+        return max_;
+    }
+
+    size_t
+    Histogram::bucketOf(const uint64_t value)
+    {
+        if (value < 2 * SUB_BUCKETS) { return value; }
+        const size_t shift = 63 - __builtin_clzll(value) - SUB_BUCKET_BITS;
+        return (shift + 1) * SUB_BUCKETS + ((value >> shift) - SUB_BUCKETS);
+    }
+
+    uint64_t
+    Histogram::lowerBound(const size_t bucket)
+    {
+        if (bucket < 2 * SUB_BUCKETS) { return bucket; }
+        const size_t shift = bucket / SUB_BUCKETS - 1;
+        return uint64_t(bucket % SUB_BUCKETS + SUB_BUCKETS) << shift;
+    }
+}
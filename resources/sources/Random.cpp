@@ -0,0 +1,16 @@
+#include "../headers/Random.hpp"
+
+#include <chrono>
+#include <random>
+
+namespace SamHovhannisyan::Random
+{
+    uint64_t
+    randomSeed()
+    {
+        std::random_device device;
+        const uint64_t entropy = uint64_t(device()) << 32 | device();
+        SplitMix64 mixer(entropy ^ uint64_t(std::chrono::steady_clock::now().time_since_epoch().count()));
+        return mixer();
+    }
+}
@@ -0,0 +1,98 @@
+#include "../headers/Scheduler.hpp"
+
+#include <algorithm>
+#include <cerrno>
+#include <stdexcept>
+
+namespace SamHovhannisyan::Scheduler
+{
+    namespace
+    {
+        const int64_t NANOSECONDS = 1000000000;
+
+        int64_t
+        toNanoseconds(const timespec& time)
+        {
+            return int64_t(time.tv_sec) * NANOSECONDS + time.tv_nsec;
+        }
+
+        timespec
+        fromNanoseconds(const int64_t nanoseconds)
+        {
+            timespec time;
+            time.tv_sec = nanoseconds / NANOSECONDS;
+            time.tv_nsec = nanoseconds % NANOSECONDS;
+            return time;
+        }
+    }
+
+    int64_t
+    now()
+    {
+        timespec time;
+        clock_gettime(CLOCK_MONOTONIC, &time);
+        return toNanoseconds(time);
+    }
+
+    Scheduler::Scheduler(const int64_t periodNanoseconds)
+        : period_(periodNanoseconds)
+    {
+        if (periodNanoseconds <= 0) { throw std::invalid_argument("Scheduler period must be positive"); }
+        restart();
+    }
+
+    void
+    Scheduler::restart()
+    {
+        next_ = fromNanoseconds(now() + period_);
+    }
+
+    size_t
+    Scheduler::wait()
+    {
+        const int64_t deadline = toNanoseconds(next_);
+        const int64_t late = now() - deadline;
+
+        if (late >= 0) {
+            // Behind schedule: run every tick that is due right away
+            ++statistics_.overruns;
+            statistics_.maxOverrun = std::max(statistics_.maxOverrun, late);
+
+            size_t due = 1 + late / period_;
+            if (due > MAX_CATCH_UP) {
+                statistics_.droppedTicks += due - MAX_CATCH_UP;
+                due = MAX_CATCH_UP;
+                // Resynchronise instead of replaying ticks that are too old
+                next_ = fromNanoseconds(now() + period_);
+            } else {
+                next_ = fromNanoseconds(deadline + due * period_);
+            }
+            statistics_.ticks += due;
+            return due;
+        }
+
+        // Absolute sleeps are restarted with the same deadline after a signal
+        while (clock_nanosleep(CLOCK_MONOTONIC, TIMER_ABSTIME, &next_, nullptr) == EINTR) {}
+
+        const int64_t jitter = std::max<int64_t>(0, now() - deadline);
+        ++statistics_.sleeps;
+        statistics_.totalJitter += jitter;
+        statistics_.maxJitter = std::max(statistics_.maxJitter, jitter);
+        ++statistics_.ticks;
+        next_ = fromNanoseconds(deadline + period_);
+        return 1;
+    }
+
+    bool
+    Scheduler::shouldRender() const
+    {
+        return now() < toNanoseconds(next_);
+    }
+
+    void
+    Scheduler::rendered(const bool drawn)
+    {
+        if (drawn) { ++statistics_.renders; }
+        else       { ++statistics_.skippedRenders; }
+    }
+}
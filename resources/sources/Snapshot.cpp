@@ -0,0 +1,169 @@
+#include "../headers/Snapshot.hpp"
+
+#include <cerrno>
+#include <cstdio>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+namespace SamHovhannisyan::Snapshot
+{
+namespace
+{
+    uint64_t
+    alignUp(const uint64_t value, const uint64_t alignment)
+    {
+        return (value + alignment - 1) / alignment * alignment;
+    }
+
+    void
+    writeAll(const int fd, const char* data, size_t size)
+    {
+        while (size > 0) {
+            const ssize_t written = ::write(fd, data, size);
+            if (written < 0) {
+                if (errno == EINTR) { continue; }
+                throw std::runtime_error("Cannot write snapshot");
+            }
+            data += written;
+            size -= static_cast<size_t>(written);
+        }
+    }
+}
+
+    MappedFile::MappedFile(const std::string& path)
+        : data_(nullptr)
+        , size_(0)
+    {
+        const int fd = ::open(path.c_str(), O_RDONLY);
+        if (fd < 0) { throw std::runtime_error("Cannot open snapshot " + path); }
+
+        struct stat info;
+        if (::fstat(fd, &info) != 0 || info.st_size == 0) {
+            ::close(fd);
+            throw std::runtime_error("Cannot read snapshot " + path);
+        }
+
+        void* mapping = ::mmap(nullptr, static_cast<size_t>(info.st_size), PROT_READ, MAP_PRIVATE, fd, 0);
+        ::close(fd);
+        if (mapping == MAP_FAILED) { throw std::runtime_error("Cannot map snapshot " + path); }
+
+        data_ = static_cast<const char*>(mapping);
+        size_ = static_cast<size_t>(info.st_size);
+    }
+
+    MappedFile::~MappedFile()
+    {
+        if (data_ != nullptr) { ::munmap(const_cast<char*>(data_), size_); }
+    }
+
+    const Header&
+    validate(const MappedFile& file, const uint32_t kind, const uint64_t cellSize)
+    {
+        if (file.size() < sizeof(Header)) { throw std::runtime_error("Snapshot is truncated"); }
+
+        const Header& header = *reinterpret_cast<const Header*>(file.data());
+        if (std::memcmp(header.magic, MAGIC, sizeof(MAGIC)) != 0) { throw std::runtime_error("Not a snapshot file"); }
+        if (header.version != VERSION)      { throw std::runtime_error("Unsupported snapshot version"); }
+        if (header.byteOrder != BYTE_ORDER_MARK) { throw std::runtime_error("Snapshot was written with another byte order"); }
+        if (header.kind != kind)            { throw std::runtime_error("Snapshot belongs to another game"); }
+        if (header.cellSize != cellSize)    { throw std::runtime_error("Snapshot cell layout does not match"); }
+
+        // A corrupt header must not wrap any size or offset around to something small
+        uint64_t cellsSize = 0;
+        uint64_t stateEnd = 0;
+        uint64_t cellsEnd = 0;
+        if (__builtin_mul_overflow(header.rows, header.cols, &cellsSize) ||
+            __builtin_mul_overflow(cellsSize, header.cellSize, &cellsSize) ||
+            __builtin_add_overflow(header.stateOffset, header.stateSize, &stateEnd) ||
+            __builtin_add_overflow(header.cellsOffset, cellsSize, &cellsEnd))
+        { throw std::runtime_error("Snapshot header is corrupt"); }
+        if (header.stateOffset < sizeof(Header) ||
+            stateEnd > header.cellsOffset ||
+            header.cellsOffset % CELLS_ALIGNMENT != 0 ||
+            cellsEnd > file.size()) 
+        { throw std::runtime_error("Snapshot is truncated"); }
+
+        return header;
+    }
+
+    void
+    writeFile(const std::string& path, const uint32_t kind, const uint64_t cellSize, const uint64_t rows,
+              const uint64_t cols, const std::string& state, const char* cells)
+    {
+        Header header;
+        std::memcpy(header.magic, MAGIC, sizeof(MAGIC));
+        header.version     = VERSION;
+        header.byteOrder   = BYTE_ORDER_MARK;
+        header.kind        = kind;
+        header.cellSize    = cellSize;
+        header.rows        = rows;
+        header.cols        = cols;
+        header.stateOffset = sizeof(Header);
+        header.stateSize   = state.size();
+        header.cellsOffset = alignUp(header.stateOffset + header.stateSize, CELLS_ALIGNMENT);
+
+        const std::string temporary = path + ".tmp";
+        const int fd = ::open(temporary.c_str(), O_WRONLY | O_CREAT | O_TRUNC, 0644);
+        if (fd < 0) { throw std::runtime_error("Cannot create snapshot " + temporary); }
+
+        try {
+            const std::string padding(header.cellsOffset - header.stateOffset - header.stateSize, '\0');
+            writeAll(fd, reinterpret_cast<const char*>(&header), sizeof(Header));
+            writeAll(fd, state.data(), state.size());
+            writeAll(fd, padding.data(), padding.size());
+            writeAll(fd, cells, rows * cols * cellSize);
+        } catch (...) {
+            ::close(fd);
+            ::unlink(temporary.c_str());
+            throw;
+        }
+
+        if (::close(fd) != 0 || std::rename(temporary.c_str(), path.c_str()) != 0) {
+            ::unlink(temporary.c_str());
+            throw std::runtime_error("Cannot write snapshot " + path);
+        }
+    }
+
+    Writer::~Writer()
+    {
+        join();
+    }
+
+    bool
+    Writer::isBusy() const
+    {
+        return busy_;
+    }
+
+    bool
+    Writer::wait()
+    {
+        join();
+        return !failed_;
+    }
+
+    void
+    Writer::start(const std::string& path, const uint32_t kind, const uint64_t cellSize,
+                  const uint64_t rows, const uint64_t cols, const std::string& state)
+    {
+        state_ = state;
+        busy_ = true;
+        failed_ = false;
+        thread_ = std::thread([this, path, kind, cellSize, rows, cols]() {
+            try {
+                writeFile(path, kind, cellSize, rows, cols, state_, cells_.data());
+            } catch (const std::exception&) {
+                failed_ = true;
+            }
+            busy_ = false;
+        });
+    }
+
+    void
+    Writer::join()
+    {
+        if (thread_.joinable()) { thread_.join(); }
+    }
+}
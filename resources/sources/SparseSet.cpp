@@ -0,0 +1,20 @@
+#include "../headers/SparseSet.hpp"
+
+#include <numeric>
+
+namespace SamHovhannisyan::SparseSet
+{
+    SparseSet::SparseSet(const size_type universe)
+        : dense_(universe)
+        , position_(universe)
+        , size_(0)
+    {}
+
+    void
+    SparseSet::fill()
+    {
+        std::iota(dense_.begin(), dense_.end(), 0);
+        std::iota(position_.begin(), position_.end(), 0);
+        size_ = dense_.size();
+    }
+}
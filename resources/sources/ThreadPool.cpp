@@ -0,0 +1,88 @@
+#include "../headers/ThreadPool.hpp"
+
+#include <algorithm>
+
+namespace SamHovhannisyan::ThreadPool
+{
+    ThreadPool::ThreadPool(const size_t threads)
+        : task_(nullptr)
+        , count_(0)
+        , generation_(0)
+        , pending_(0)
+        , stop_(false)
+    {
+        const size_t total = threads != 0 ? threads : std::max(1u, std::thread::hardware_concurrency());
+        for (size_t i = 1; i < total; ++i) { workers_.emplace_back(&ThreadPool::work, this, i); }
+    }
+
+    ThreadPool::~ThreadPool()
+    {
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            stop_ = true;
+        }
+        start_.notify_all();
+        for (std::thread& worker : workers_) { worker.join(); }
+    }
+
+    void
+    ThreadPool::parallelFor(const size_t count, const task_type& task)
+    {
+        if (workers_.empty() || count < 2) {
+            if (count != 0) { task(0, count); }
+            return;
+        }
+
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            task_ = &task;
+            count_ = count;
+            pending_ = workers_.size();
+            error_ = nullptr;
+            ++generation_;
+        }
+        start_.notify_all();
+        runChunk(0);
+
+        std::unique_lock<std::mutex> lock(mutex_);
+        done_.wait(lock, [this]() { return pending_ == 0; });
+        task_ = nullptr;
+        if (error_) {
+            std::exception_ptr error = error_;
+            error_ = nullptr;
+            std::rethrow_exception(error);
+        }
+    }
+
+    void
+    ThreadPool::work(const size_t index)
+    {
+        size_t seen = 0;
+        std::unique_lock<std::mutex> lock(mutex_);
+        while (true) {
+            start_.wait(lock, [this, seen]() { return stop_ || generation_ != seen; });
+            if (stop_) { return; }
+            seen = generation_;
+
+            lock.unlock();
+            runChunk(index);
+            lock.lock();
+            if (--pending_ == 0) { done_.notify_one(); }
+        }
+    }
+
+    void
+    ThreadPool::runChunk(const size_t index)
+    {
+        // Chunks differ in size by at most one index
+        const size_t begin = count_ * index / size();
+        const size_t end = count_ * (index + 1) / size();
+        if (begin == end) { return; }
+
+        try { (*task_)(begin, end); }
+        catch (...) {
+            std::lock_guard<std::mutex> lock(mutex_);
+            if (!error_) { error_ = std::current_exception(); }
+        }
+    }
+}
@@ -0,0 +1,122 @@
+#include "../headers/Viewport.hpp"
+
+#include <algorithm>
+
+namespace SamHovhannisyan::Viewport
+{
+    namespace
+    {
+        /// value + delta, kept at 0 instead of wrapping below it
+        size_t
+        shift(const size_t value, const long delta)
+        {
+            if (delta >= 0) { return value + size_t(delta); }
+            const size_t back = size_t(-(delta + 1)) + 1;
+            return back > value ? 0 : value - back;
+        }
+
+        /// The nearest start of a window of shown cells with position margin cells inside it
+        size_t
+        keepInside(const size_t start, const size_t shown, const size_t position, size_t margin)
+        {
+            if (shown == 0) { return start; }
+            margin = std::min(margin, (shown - 1) / 2);
+            if (position < start + margin) { return position < margin ? 0 : position - margin; }
+            if (position + margin >= start + shown) { return position + margin + 1 - shown; }
+            return start;
+        }
+    }
+
+    Viewport::Viewport(const size_t cellWidth, const size_t cellHeight)
+        : cellWidth_(std::max<size_t>(cellWidth, 1))
+        , cellHeight_(std::max<size_t>(cellHeight, 1))
+        , boardRows_(0)
+        , boardCols_(0)
+        , top_(0)
+        , left_(0)
+        , screenRows_(0)
+        , screenCols_(0)
+    {
+    }
+
+    void
+    Viewport::setBoard(const size_t rows, const size_t cols)
+    {
+        boardRows_ = rows;
+        boardCols_ = cols;
+        origin_ = clamp(origin_);
+    }
+
+    void
+    Viewport::setScreen(const int top, const int left, const int rows, const int cols)
+    {
+        top_ = top;
+        left_ = left;
+        screenRows_ = rows > 0 ? size_t(rows) / cellHeight_ : 0;
+        screenCols_ = cols > 0 ? size_t(cols) / cellWidth_ : 0;
+        origin_ = clamp(origin_);
+    }
+
+    size_t
+    Viewport::getRows() const
+    {
+        return std::min(boardRows_, screenRows_);
+    }
+
+    size_t
+    Viewport::getCols() const
+    {
+        return std::min(boardCols_, screenCols_);
+    }
+
+    bool
+    Viewport::isVisible(const Coordinate& coord) const
+    {
+        return coord.y >= origin_.y && coord.y - origin_.y < getRows()
+            && coord.x >= origin_.x && coord.x - origin_.x < getCols();
+    }
+
+    bool
+    Viewport::toBoard(const int y, const int x, Coordinate& coord) const
+    {
+        if (y < top_ || x < left_) { return false; }
+        const size_t row = size_t(y - top_) / cellHeight_;
+        const size_t col = size_t(x - left_) / cellWidth_;
+        if (row >= getRows() || col >= getCols()) { return false; }
+        coord = Coordinate(origin_.x + col, origin_.y + row);
+        return true;
+    }
+
+    bool
+    Viewport::pan(const long dy, const long dx)
+    {
+        return scrollTo(Coordinate(shift(origin_.x, dx), shift(origin_.y, dy)));
+    }
+
+    bool
+    Viewport::scrollTo(const Coordinate& origin)
+    {
+        const Coordinate previous = origin_;
+        origin_ = clamp(origin);
+        return origin_ != previous;
+    }
+
+    bool
+    Viewport::center(const Coordinate& coord)
+    {
+        return scrollTo(Coordinate(shift(coord.x, -long(getCols() / 2)), shift(coord.y, -long(getRows() / 2))));
+    }
+
+    bool
+    Viewport::follow(const Coordinate& coord, const size_t margin)
+    {
+        return scrollTo(Coordinate(keepInside(origin_.x, getCols(), coord.x, margin),
+                                   keepInside(origin_.y, getRows(), coord.y, margin)));
+    }
+
+    Viewport::Coordinate
+    Viewport::clamp(const Coordinate& origin) const
+    {
+        return Coordinate(std::min(origin.x, boardCols_ - getCols()), std::min(origin.y, boardRows_ - getRows()));
+    }
+}
@@ -0,0 +1,153 @@
+#include "../headers/WorkStealingPool.hpp"
+
+#include <algorithm>
+
+namespace SamHovhannisyan::WorkStealingPool
+{
+    namespace
+    {
+        /// The pool and deque of the worker running on this thread, if any
+        thread_local const WorkStealingPool* currentPool = nullptr;
+        thread_local size_t currentQueue = 0;
+    }
+
+    WorkStealingPool::WorkStealingPool(const size_t threads)
+        : pending_(0)
+        , queued_(0)
+        , next_(0)
+        , cancelled_(false)
+        , stop_(false)
+    {
+        const size_t total = threads != 0 ? threads : std::max(1u, std::thread::hardware_concurrency());
+        for (size_t i = 0; i < total; ++i) { queues_.emplace_back(new Queue()); }
+        for (size_t i = 0; i < total; ++i) { workers_.emplace_back(&WorkStealingPool::work, this, i); }
+    }
+
+    WorkStealingPool::~WorkStealingPool()
+    {
+        cancel();
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            stop_ = true;
+        }
+        wake_.notify_all();
+        for (std::thread& worker : workers_) { worker.join(); }
+    }
+
+    void
+    WorkStealingPool::submit(task_type task)
+    {
+        // A cancelled search must not be refilled by its own running tasks
+        if (cancelled_) { return; }
+        const size_t index = currentPool == this ? currentQueue : next_++ % queues_.size();
+        ++pending_;
+        {
+            std::lock_guard<std::mutex> lock(queues_[index]->mutex);
+            queues_[index]->tasks.push_back(std::move(task));
+        }
+        ++queued_;
+
+        // Taking the lock orders the notification after a worker's check of queued_
+        { std::lock_guard<std::mutex> lock(mutex_); }
+        wake_.notify_one();
+    }
+
+    void
+    WorkStealingPool::wait()
+    {
+        task_type task;
+        while (pending_ != 0) {
+            if (take(next_++ % queues_.size(), task)) {
+                run(task);
+                continue;
+            }
+            std::unique_lock<std::mutex> lock(mutex_);
+            done_.wait(lock, [this]() { return pending_ == 0 || queued_ != 0; });
+        }
+
+        cancelled_ = false;
+        std::lock_guard<std::mutex> lock(mutex_);
+        if (error_) {
+            std::exception_ptr error = error_;
+            error_ = nullptr;
+            std::rethrow_exception(error);
+        }
+    }
+
+    void
+    WorkStealingPool::cancel()
+    {
+        cancelled_ = true;
+        size_t dropped = 0;
+        for (const std::unique_ptr<Queue>& queue : queues_) {
+            std::lock_guard<std::mutex> lock(queue->mutex);
+            dropped += queue->tasks.size();
+            queue->tasks.clear();
+        }
+        queued_ -= dropped;
+        if (dropped != 0 && (pending_ -= dropped) == 0) {
+            std::lock_guard<std::mutex> lock(mutex_);
+            done_.notify_all();
+        }
+    }
+
+    void
+    WorkStealingPool::work(const size_t index)
+    {
+        currentPool = this;
+        currentQueue = index;
+        task_type task;
+        while (true) {
+            if (take(index, task)) {
+                run(task);
+                continue;
+            }
+            std::unique_lock<std::mutex> lock(mutex_);
+            wake_.wait(lock, [this]() { return stop_ || queued_ != 0; });
+            if (stop_) { return; }
+        }
+    }
+
+    bool
+    WorkStealingPool::take(const size_t index, task_type& task)
+    {
+        if (queued_ == 0) { return false; }
+        {
+            Queue& own = *queues_[index];
+            std::lock_guard<std::mutex> lock(own.mutex);
+            if (!own.tasks.empty()) {
+                task = std::move(own.tasks.back());
+                own.tasks.pop_back();
+                --queued_;
+                return true;
+            }
+        }
+        for (size_t i = 1; i < queues_.size(); ++i) {
+            Queue& victim = *queues_[(index + i) % queues_.size()];
+            std::lock_guard<std::mutex> lock(victim.mutex);
+            if (!victim.tasks.empty()) {
+                task = std::move(victim.tasks.front());
+                victim.tasks.pop_front();
+                --queued_;
+                return true;
+            }
+        }
+        return false;
+    }
+
+    void
+    WorkStealingPool::run(task_type& task)
+    {
+        try { task(); }
+        catch (...) {
+            std::lock_guard<std::mutex> lock(mutex_);
+            if (!error_) { error_ = std::current_exception(); }
+        }
+        task = nullptr;
+
+        if (--pending_ == 0) {
+            std::lock_guard<std::mutex> lock(mutex_);
+            done_.notify_all();
+        }
+    }
+}
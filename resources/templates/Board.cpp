@@ -3,6 +3,8 @@
 
 #include "../headers/Board.hpp"
 
+#include <algorithm>
+
 namespace SamHovhannisyan
 {
 namespace Board
@@ -11,7 +13,9 @@ namespace Board
     Board<T>::Board(const size_type rows, const size_type cols)
         : rows_(rows)
         , cols_(cols)
-        , board_(rows, std::vector<T>(cols, T()))
+        , board_(rows * cols, T())
+        , tracking_(false)
+        , allDirty_(false)
     {}
 
     template <typename T>
@@ -19,6 +23,10 @@ namespace Board
         : rows_(rhv.rows_)
         , cols_(rhv.cols_)
         , board_(rhv.board_) 
+        , tracking_(rhv.tracking_)
+        , allDirty_(rhv.allDirty_)
+        , dirty_(rhv.dirty_)
+        , dirtyMask_(rhv.dirtyMask_)
     {}
 
     template <typename T>
@@ -29,15 +37,19 @@ namespace Board
             rows_ = rhv.rows_;
             cols_ = rhv.cols_;
             board_ = rhv.board_;
+            tracking_ = rhv.tracking_;
+            allDirty_ = rhv.allDirty_;
+            dirty_ = rhv.dirty_;
+            dirtyMask_ = rhv.dirtyMask_;
         }
         return *this;
     }
 
     template <typename T>
-    std::vector<std::vector<T>> 
+    typename Board<T>::view_type
     Board<T>::getBoard() const
     {
-        return board_;
+        return view_type(board_.data(), rows_, cols_);
     }
 
     template <typename T>
@@ -54,27 +66,156 @@ namespace Board
         return cols_;
     }
 
+    template <typename T>
+    typename Board<T>::size_type 
+    Board<T>::size() const
+    {
+        return board_.size();
+    }
+
     template <typename T>
     void 
     Board<T>::setRows(const size_type rows)
     {
-        rows_ = rows;
+        resize(rows, cols_);
     }
 
     template <typename T>
     void
     Board<T>::setCols(const size_type cols)
     {
+        resize(rows_, cols);
+    }
+
+    template <typename T>
+    void
+    Board<T>::resize(const size_type rows, const size_type cols)
+    {
+        if (tracking_) {
+            dirtyMask_.assign(rows * cols, false);
+            dirty_.clear();
+            allDirty_ = true;
+        }
+        if (cols == cols_) {
+            board_.resize(rows * cols, T());
+            rows_ = rows;
+            return;
+        }
+
+        std::vector<T> board(rows * cols, T());
+        const size_type keepRows = std::min(rows, rows_);
+        const size_type keepCols = std::min(cols, cols_);
+        for (size_type y = 0; y < keepRows; ++y) {
+            std::copy(board_.begin() + y * cols_, board_.begin() + y * cols_ + keepCols, board.begin() + y * cols);
+        }
+        board_.swap(board);
+        rows_ = rows;
         cols_ = cols;
     }
 
+    template <typename T>
+    typename Board<T>::size_type
+    Board<T>::indexOf(const coordinate& coord) const
+    {
+        assert(coord.y < getRows());
+        assert(coord.x < getCols());
+        return coord.y * cols_ + coord.x;
+    }
+
+    template <typename T>
+    typename Board<T>::coordinate
+    Board<T>::coordinateOf(const size_type index) const
+    {
+        assert(index < size());
+        return coordinate(index % cols_, index / cols_);
+    }
+
+    template <typename T>
+    T&
+    Board<T>::operator[](const size_type index)
+    {
+        assert(index < size());
+        touch(index);
+        return board_[index];
+    }
+
+    template <typename T>
+    const T&
+    Board<T>::operator[](const size_type index) const
+    {
+        assert(index < size());
+        return board_[index];
+    }
+
+    template <typename T>
+    T*
+    Board<T>::data()
+    {
+        markAllDirty();
+        return board_.data();
+    }
+
+    template <typename T>
+    const T*
+    Board<T>::data() const
+    {
+        return board_.data();
+    }
+
+    template <typename T>
+    typename Board<T>::row_type
+    Board<T>::row(const size_type y)
+    {
+        assert(y < getRows());
+        markAllDirty();
+        return row_type(board_.data() + y * cols_, cols_);
+    }
+
+    template <typename T>
+    typename Board<T>::const_row_type
+    Board<T>::row(const size_type y) const
+    {
+        assert(y < getRows());
+        return const_row_type(board_.data() + y * cols_, cols_);
+    }
+
+    template <typename T>
+    typename Board<T>::iterator
+    Board<T>::begin()
+    {
+        markAllDirty();
+        return board_.data();
+    }
+
+    template <typename T>
+    typename Board<T>::iterator
+    Board<T>::end()
+    {
+        return board_.data() + board_.size();
+    }
+
+    template <typename T>
+    typename Board<T>::const_iterator
+    Board<T>::begin() const
+    {
+        return board_.data();
+    }
+
+    template <typename T>
+    typename Board<T>::const_iterator
+    Board<T>::end() const
+    {
+        return board_.data() + board_.size();
+    }
+
     template <typename T>
     T&
     Board<T>::operator()(const coordinate& coord)
     {
         assert(coord.y < getRows());
         assert(coord.x < getCols());
-        return board_[coord.y][coord.x];
+        touch(coord.y * cols_ + coord.x);
+        return board_[coord.y * cols_ + coord.x];
     }
 
     template <typename T>
@@ -83,7 +224,7 @@ namespace Board
     {
         assert(coord.y < getRows());
         assert(coord.x < getCols());
-        return board_[coord.y][coord.x];
+        return board_[coord.y * cols_ + coord.x];
     }
 
     template <typename T>
@@ -92,7 +233,79 @@ namespace Board
     {
         assert(coord.y < getRows());
         assert(coord.x < getCols());
-        board_[coord.y][coord.x] = value;
+        touch(coord.y * cols_ + coord.x);
+        board_[coord.y * cols_ + coord.x] = value;
+    }
+
+    template <typename T>
+    void 
+    Board<T>::fill(const T& value)
+    {
+        markAllDirty();
+        std::fill(board_.begin(), board_.end(), value);
+    }
+
+    template <typename T>
+    void
+    Board<T>::setDirtyTracking(const bool enabled)
+    {
+        tracking_ = enabled;
+        dirty_.clear();
+        dirtyMask_.assign(enabled ? board_.size() : 0, false);
+        allDirty_ = enabled;
+    }
+
+    template <typename T>
+    bool
+    Board<T>::isDirtyTracking() const
+    {
+        return tracking_;
+    }
+
+    template <typename T>
+    void
+    Board<T>::markDirty(const coordinate& coord)
+    {
+        touch(indexOf(coord));
+    }
+
+    template <typename T>
+    void
+    Board<T>::markAllDirty()
+    {
+        allDirty_ = tracking_;
+    }
+
+    template <typename T>
+    bool
+    Board<T>::isAllDirty() const
+    {
+        return allDirty_;
+    }
+
+    template <typename T>
+    const std::vector<typename Board<T>::size_type>&
+    Board<T>::getDirty() const
+    {
+        return dirty_;
+    }
+
+    template <typename T>
+    void
+    Board<T>::clearDirty()
+    {
+        for (const size_type index : dirty_) { dirtyMask_[index] = false; }
+        dirty_.clear();
+        allDirty_ = false;
+    }
+
+    template <typename T>
+    void
+    Board<T>::touch(const size_type index)
+    {
+        if (!tracking_ || allDirty_ || dirtyMask_[index]) { return; }
+        dirtyMask_[index] = true;
+        dirty_.push_back(index);
     }
 }
 }
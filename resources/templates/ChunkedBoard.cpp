@@ -0,0 +1,142 @@
+#ifndef __CHUNKED_BOARD_CPP__
+#define __CHUNKED_BOARD_CPP__
+
+#include "../headers/ChunkedBoard.hpp"
+
+namespace SamHovhannisyan::Board
+{
+    template <typename T, size_t TileSize>
+    ChunkedBoard<T, TileSize>::ChunkedBoard(const size_type rows, const size_type cols, const T& value, const size_type capacity)
+        : rows_(rows)
+        , cols_(cols)
+        , default_(value)
+        , capacity_(capacity)
+        , lastKey_(0)
+        , lastTile_(nullptr)
+    {
+        assert((rows + TileSize - 1) / TileSize <= (size_type(1) << 32));
+        assert((cols + TileSize - 1) / TileSize <= (size_type(1) << 32));
+    }
+
+    template <typename T, size_t TileSize>
+    void
+    ChunkedBoard<T, TileSize>::setCapacity(const size_type capacity)
+    {
+        capacity_ = capacity;
+        while (capacity_ != 0 && tiles_.size() > capacity_) { evictOldest(); }
+    }
+
+    template <typename T, size_t TileSize>
+    typename ChunkedBoard<T, TileSize>::tile_key
+    ChunkedBoard<T, TileSize>::keyOf(const coordinate& coord)
+    {
+        return (tile_key(coord.y / TileSize) << 32) | tile_key(coord.x / TileSize);
+    }
+
+    template <typename T, size_t TileSize>
+    typename ChunkedBoard<T, TileSize>::coordinate
+    ChunkedBoard<T, TileSize>::originOf(const tile_key key)
+    {
+        return coordinate((key & 0xffffffff) * TileSize, (key >> 32) * TileSize);
+    }
+
+    template <typename T, size_t TileSize>
+    bool
+    ChunkedBoard<T, TileSize>::isResident(const coordinate& coord) const
+    {
+        return tiles_.find(keyOf(coord)) != tiles_.end();
+    }
+
+    template <typename T, size_t TileSize>
+    T&
+    ChunkedBoard<T, TileSize>::operator()(const coordinate& coord)
+    {
+        assert(coord.y < rows_);
+        assert(coord.x < cols_);
+        return findTile(keyOf(coord), true)->cells[cellOf(coord)];
+    }
+
+    template <typename T, size_t TileSize>
+    const T&
+    ChunkedBoard<T, TileSize>::operator()(const coordinate& coord) const
+    {
+        assert(coord.y < rows_);
+        assert(coord.x < cols_);
+        const Tile* tile = findTile(keyOf(coord), false);
+        return tile == nullptr ? default_ : tile->cells[cellOf(coord)];
+    }
+
+    template <typename T, size_t TileSize>
+    void
+    ChunkedBoard<T, TileSize>::setValue(const coordinate& coord, const T& value)
+    {
+        (*this)(coord) = value;
+    }
+
+    template <typename T, size_t TileSize>
+    void
+    ChunkedBoard<T, TileSize>::clear()
+    {
+        while (!tiles_.empty()) { evictOldest(); }
+    }
+
+    template <typename T, size_t TileSize>
+    typename ChunkedBoard<T, TileSize>::Tile*
+    ChunkedBoard<T, TileSize>::findTile(const tile_key key, const bool allocate) const
+    {
+        // Runs of accesses usually stay inside one tile
+        if (lastTile_ != nullptr && lastKey_ == key) { return lastTile_; }
+
+        const auto found = tiles_.find(key);
+        if (found != tiles_.end()) {
+            lru_.splice(lru_.begin(), lru_, found->second.position);
+            lastKey_ = key;
+            lastTile_ = found->second.tile.get();
+            return lastTile_;
+        }
+
+        if (!allocate && !loader_) { return nullptr; }
+
+        // A miss reuses the spare tile, so probing empty tiles through the loader or cycling
+        // through a full cache does not allocate each time
+        std::unique_ptr<Tile> tile = spare_ ? std::move(spare_) : std::unique_ptr<Tile>(new Tile);
+        tile->cells.fill(default_);
+        const bool loaded = loader_ && loader_(key, *tile);
+        if (!allocate && !loaded) {
+            spare_ = std::move(tile);
+            return nullptr;
+        }
+
+        if (capacity_ != 0 && tiles_.size() >= capacity_) { evictOldest(); }
+        lru_.push_front(key);
+        Entry& entry = tiles_[key];
+        entry.tile = std::move(tile);
+        entry.position = lru_.begin();
+        lastKey_ = key;
+        lastTile_ = entry.tile.get();
+        return lastTile_;
+    }
+
+    template <typename T, size_t TileSize>
+    void
+    ChunkedBoard<T, TileSize>::evictOldest() const
+    {
+        assert(!lru_.empty());
+        const tile_key key = lru_.back();
+        const auto found = tiles_.find(key);
+        if (evictor_) { evictor_(key, *found->second.tile); }
+        if (lastTile_ == found->second.tile.get()) { lastTile_ = nullptr; }
+        spare_ = std::move(found->second.tile);
+        tiles_.erase(found);
+        lru_.pop_back();
+    }
+
+    template <typename T, size_t TileSize>
+    typename ChunkedBoard<T, TileSize>::size_type
+    ChunkedBoard<T, TileSize>::cellOf(const coordinate& coord)
+    {
+        return (coord.y % TileSize) * TileSize + coord.x % TileSize;
+    }
+}
+
+#endif // __CHUNKED_BOARD_CPP__
@@ -0,0 +1,52 @@
+#ifndef __RING_BUFFER_CPP__
+#define __RING_BUFFER_CPP__
+
+#include "../headers/RingBuffer.hpp"
+
+namespace SamHovhannisyan::RingBuffer
+{
+    template <typename T>
+    RingBuffer<T>::RingBuffer(const size_type capacity)
+        : data_(capacity)
+        , head_(0)
+        , size_(0)
+    {}
+
+    template <typename T>
+    void
+    RingBuffer<T>::push_front(const T& value)
+    {
+        assert(!full());
+        head_ = head_ == 0 ? data_.size() - 1 : head_ - 1;
+        data_[head_] = value;
+        ++size_;
+    }
+
+    template <typename T>
+    void
+    RingBuffer<T>::push_back(const T& value)
+    {
+        assert(!full());
+        data_[wrap(head_ + size_)] = value;
+        ++size_;
+    }
+
+    template <typename T>
+    void
+    RingBuffer<T>::pop_front()
+    {
+        assert(!empty());
+        head_ = wrap(head_ + 1);
+        --size_;
+    }
+
+    template <typename T>
+    void
+    RingBuffer<T>::pop_back()
+    {
+        assert(!empty());
+        --size_;
+    }
+}
+
+#endif // __RING_BUFFER_CPP__
@@ -0,0 +1,54 @@
+#ifndef __SPSC_QUEUE_CPP__
+#define __SPSC_QUEUE_CPP__
+
+#include "../headers/SpscQueue.hpp"
+
+namespace SamHovhannisyan::SpscQueue
+{
+    template <typename T, size_t Capacity>
+    SpscQueue<T, Capacity>::SpscQueue()
+        : head_(0)
+        , tail_(0)
+        , buffer_()
+    {}
+
+    template <typename T, size_t Capacity>
+    bool
+    SpscQueue<T, Capacity>::push(const T& value)
+    {
+        const size_type tail = tail_.load(std::memory_order_relaxed);
+        if (tail - head_.load(std::memory_order_acquire) == Capacity) { return false; }
+        buffer_[tail & (Capacity - 1)] = value;
+        tail_.store(tail + 1, std::memory_order_release);
+        return true;
+    }
+
+    template <typename T, size_t Capacity>
+    bool
+    SpscQueue<T, Capacity>::pop(T& value)
+    {
+        const size_type head = head_.load(std::memory_order_relaxed);
+        if (head == tail_.load(std::memory_order_acquire)) { return false; }
+        value = buffer_[head & (Capacity - 1)];
+        head_.store(head + 1, std::memory_order_release);
+        return true;
+    }
+
+    template <typename T, size_t Capacity>
+    bool
+    SpscQueue<T, Capacity>::empty() const
+    {
+        return size() == 0;
+    }
+
+    template <typename T, size_t Capacity>
+    typename SpscQueue<T, Capacity>::size_type
+    SpscQueue<T, Capacity>::size() const
+    {
+        // Read head first: tail only grows, so the difference can never go negative
+        const size_type head = head_.load(std::memory_order_acquire);
+        return tail_.load(std::memory_order_acquire) - head;
+    }
+}
+
+#endif // __SPSC_QUEUE_CPP__
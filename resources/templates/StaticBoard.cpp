@@ -0,0 +1,113 @@
+#ifndef __STATIC_BOARD_CPP__
+#define __STATIC_BOARD_CPP__
+
+#include "../headers/StaticBoard.hpp"
+
+namespace SamHovhannisyan::Board
+{
+    template <typename T, size_t Rows, size_t Cols>
+    constexpr
+    StaticBoard<T, Rows, Cols>::StaticBoard()
+        : board_()
+    {}
+
+    template <typename T, size_t Rows, size_t Cols>
+    constexpr
+    StaticBoard<T, Rows, Cols>::StaticBoard(const T& value)
+        : board_()
+    {
+        fill(value);
+    }
+
+    template <typename T, size_t Rows, size_t Cols>
+    typename StaticBoard<T, Rows, Cols>::view_type
+    StaticBoard<T, Rows, Cols>::getBoard() const
+    {
+        return view_type(board_.data(), Rows, Cols);
+    }
+
+    template <typename T, size_t Rows, size_t Cols>
+    constexpr typename StaticBoard<T, Rows, Cols>::size_type
+    StaticBoard<T, Rows, Cols>::indexOf(const coordinate& coord)
+    {
+        assert(coord.y < Rows);
+        assert(coord.x < Cols);
+        return coord.y * Cols + coord.x;
+    }
+
+    template <typename T, size_t Rows, size_t Cols>
+    constexpr typename StaticBoard<T, Rows, Cols>::coordinate
+    StaticBoard<T, Rows, Cols>::coordinateOf(const size_type index)
+    {
+        assert(index < SIZE);
+        return coordinate(index % Cols, index / Cols);
+    }
+
+    template <typename T, size_t Rows, size_t Cols>
+    constexpr T&
+    StaticBoard<T, Rows, Cols>::operator[](const size_type index)
+    {
+        assert(index < SIZE);
+        return board_[index];
+    }
+
+    template <typename T, size_t Rows, size_t Cols>
+    constexpr const T&
+    StaticBoard<T, Rows, Cols>::operator[](const size_type index) const
+    {
+        assert(index < SIZE);
+        return board_[index];
+    }
+
+    template <typename T, size_t Rows, size_t Cols>
+    typename StaticBoard<T, Rows, Cols>::row_type
+    StaticBoard<T, Rows, Cols>::row(const size_type y)
+    {
+        assert(y < Rows);
+        return row_type(board_.data() + y * Cols, Cols);
+    }
+
+    template <typename T, size_t Rows, size_t Cols>
+    typename StaticBoard<T, Rows, Cols>::const_row_type
+    StaticBoard<T, Rows, Cols>::row(const size_type y) const
+    {
+        assert(y < Rows);
+        return const_row_type(board_.data() + y * Cols, Cols);
+    }
+
+    template <typename T, size_t Rows, size_t Cols>
+    constexpr T&
+    StaticBoard<T, Rows, Cols>::operator()(const coordinate& coord)
+    {
+        assert(coord.y < Rows);
+        assert(coord.x < Cols);
+        return board_[coord.y * Cols + coord.x];
+    }
+
+    template <typename T, size_t Rows, size_t Cols>
+    constexpr const T&
+    StaticBoard<T, Rows, Cols>::operator()(const coordinate& coord) const
+    {
+        assert(coord.y < Rows);
+        assert(coord.x < Cols);
+        return board_[coord.y * Cols + coord.x];
+    }
+
+    template <typename T, size_t Rows, size_t Cols>
+    constexpr void
+    StaticBoard<T, Rows, Cols>::setValue(const coordinate& coord, const T& value)
+    {
+        assert(coord.y < Rows);
+        assert(coord.x < Cols);
+        board_[coord.y * Cols + coord.x] = value;
+    }
+
+    template <typename T, size_t Rows, size_t Cols>
+    constexpr void
+    StaticBoard<T, Rows, Cols>::fill(const T& value)
+    {
+        for (size_type i = 0; i < SIZE; ++i) { board_[i] = value; }
+    }
+}
+
+#endif // __STATIC_BOARD_CPP__